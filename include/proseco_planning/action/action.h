@@ -42,6 +42,22 @@ struct ActionNoise {
   float m_sigmaVx{0.0f};
 };
 
+/**
+ * @brief This struct defines the data of an action that is only recorded for inverse reinforcement
+ * learning, i.e. the noise and the selection likelihood of the action.
+ */
+struct ActionAnnotation {
+  /// The noise added to the action.
+  ActionNoise noise;
+
+  /// The probability for selecting this action. Currently only used for exp_q sampling final
+  /// selection.
+  float m_selectionLikelihood{0.0f};
+
+  /// The weights for selecting this action.
+  std::vector<float> m_selectionWeights;
+};
+
 /**
  * @brief The Action class is a generic class for actions.
  */
@@ -53,6 +69,12 @@ class Action {
 
   Action(ActionClass actionClass, float accelerationX, float accelerationY);
 
+  Action(const Action& action);
+
+  const ActionAnnotation& annotation() const;
+
+  ActionAnnotation& annotation();
+
   void updateActionClass(const ActionSpace& actionSpace, const Vehicle& vehicle);
 
   static float getSimilarity(const ActionPtr& x, const ActionPtr& y, const float gamma);
@@ -81,15 +103,8 @@ class Action {
   /// The validity of an action given the current state of the vehicle.
   bool m_invalidAction{false};
 
-  /// The noise added to the action.
-  ActionNoise noise;
-
-  /// The probability for selecting this action. Currently only used for exp_q sampling final
-  /// selection.
-  float m_selectionLikelihood{0.0f};
-
-  /// The weights for selecting this action.
-  std::vector<float> m_selectionWeights;
+  /// The annotation of the action, only allocated for annotated (e.g. noisy) actions.
+  std::unique_ptr<ActionAnnotation> m_annotation;
 };
 
 void to_json(json& j, const Action& action);
@@ -43,6 +43,12 @@ class ActionSpace {
                                      CollisionChecker& collisionChecker,
                                      const TrajectoryGenerator& trajectoryGenerator);
 
+  static ActionSet sampleValidActions(const Vehicle& vehicle,
+                                      const std::function<ActionPtr()>& samplingFunction,
+                                      const unsigned int nActions,
+                                      CollisionChecker& collisionChecker,
+                                      const TrajectoryGenerator& trajectoryGenerator);
+
   virtual ActionSet getPredefinedActions() const = 0;
 
   virtual ActionSet getModerateActions(const Vehicle& vehicle) const = 0;
@@ -56,6 +62,13 @@ class ActionSpace {
   virtual ActionPtr sampleRandomActionInActionClass(const ActionClass& actionClass,
                                                     const Vehicle& vehicle) const = 0;
 
+  virtual ActionSet sampleRandomActions(const Vehicle& vehicle,
+                                        const unsigned int nActions) const = 0;
+
+  virtual ActionSet sampleRandomActionsInActionClass(const ActionClass& actionClass,
+                                                     const Vehicle& vehicle,
+                                                     const unsigned int nActions) const = 0;
+
   /// The map that assigns a name string to each action class.
   static const std::map<ActionClass, std::string> ACTION_CLASS_NAME_MAP;
 
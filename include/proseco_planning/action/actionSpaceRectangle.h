@@ -67,6 +67,11 @@ class ActionSpaceRectangle : public ActionSpace {
   ActionPtr sampleRandomActionInActionClass(const ActionClass& actionClass,
                                             const Vehicle& vehicle) const override;
 
+  ActionSet sampleRandomActions(const Vehicle& vehicle, const unsigned int nActions) const override;
+
+  ActionSet sampleRandomActionsInActionClass(const ActionClass& actionClass, const Vehicle& vehicle,
+                                             const unsigned int nActions) const override;
+
   static ActionPtr sampleRandomActionInBoundary(const ActionBoundary& boundary);
 
   /// The ActionSpaceRectangle configuration.
@@ -0,0 +1,171 @@
+/**
+ * @file actionStatistics.h
+ * @brief This file defines the ActionStatistics class, the search statistics of the actions of an
+ * agent.
+ * @copyright Copyright (c) 2021
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+#include "proseco_planning/action/actionClass.h"
+#include "proseco_planning/util/alias.h"
+
+namespace proseco_planning {
+
+/**
+ * @brief The ActionStatistics class stores the visits, values and UCT scores of the actions of an
+ * agent as well as of their action classes.
+ * @details The statistics are stored as a structure of arrays: the i-th element of each action
+ * array belongs to the i-th action, the i-th element of each class array to the i-th action class.
+ * Actions and action classes are kept in insertion order. Each action refers to its action class
+ * via an index into the (small) class table, so that sweeps over the actions (e.g. argmax,
+ * normalization, similarity updates) are linear scans over contiguous memory.
+ *
+ * Updates through `addVisits` and `setValue` maintain the total visits, the bounds of the action
+ * values and the class statistics incrementally, the UCT scores are only evaluated when they are
+ * needed (`argmaxUCT`, `uctScores`). Code that writes to `m_visits` or `m_values` directly has to
+ * call `invalidate` afterwards.
+ */
+class ActionStatistics {
+ public:
+  /// The index returned if an action or action class is not part of the statistics.
+  static constexpr std::size_t npos{std::numeric_limits<std::size_t>::max()};
+
+  std::size_t add(const ActionPtr& action);
+
+  std::size_t find(const ActionPtr& action) const;
+
+  std::size_t index(const ActionPtr& action) const;
+
+  std::size_t findClass(const ActionClass actionClass) const;
+
+  std::size_t classIndex(const ActionClass actionClass) const;
+
+  void clear();
+
+  void addVisits(const std::size_t i, const float visits);
+
+  void setValue(const std::size_t i, const float value);
+
+  void invalidate();
+
+  float minValue() const;
+
+  float maxValue() const;
+
+  float uctScore(const std::size_t i, const float cp, const float logTotalVisits) const;
+
+  std::size_t argmaxUCT(const float cp) const;
+
+  const std::vector<float>& uctScores(const float cp) const;
+
+  json toJSON() const;
+
+  /// The sum of the visits of all actions.
+  float totalVisits() const { return m_totalVisits; }
+
+  /// Checks whether the action is part of the statistics.
+  bool contains(const ActionPtr& action) const { return find(action) != npos; }
+
+  /// The number of actions.
+  std::size_t size() const { return m_actions.size(); }
+
+  /// Checks whether there are no actions.
+  bool empty() const { return m_actions.empty(); }
+
+  /// The number of action classes.
+  std::size_t nClasses() const { return m_classes.size(); }
+
+  /// The visits of the action, throws std::out_of_range if the action does not exist.
+  float& visits(const ActionPtr& action) { return m_visits[index(action)]; }
+  float visits(const ActionPtr& action) const { return m_visits[index(action)]; }
+
+  /// The value of the action, throws std::out_of_range if the action does not exist.
+  float& value(const ActionPtr& action) { return m_values[index(action)]; }
+  float value(const ActionPtr& action) const { return m_values[index(action)]; }
+
+  /// The visits of the action class, throws std::out_of_range if the class does not exist.
+  float classVisits(const ActionClass actionClass) const {
+    return m_classVisits[classIndex(actionClass)];
+  }
+
+  /// The value of the action class, throws std::out_of_range if the class does not exist.
+  float classValue(const ActionClass actionClass) const {
+    return m_classValues[classIndex(actionClass)];
+  }
+
+  /// The UCT value of the action class, throws std::out_of_range if the class does not exist.
+  float classUCT(const ActionClass actionClass) const {
+    return m_classUCT[classIndex(actionClass)];
+  }
+
+  /// The number of actions of the action class, throws std::out_of_range if the class does not
+  /// exist.
+  int classCount(const ActionClass actionClass) const {
+    return m_classCount[classIndex(actionClass)];
+  }
+
+  /// The actions.
+  std::vector<ActionPtr> m_actions;
+
+  /// The visits of each action.
+  std::vector<float> m_visits;
+
+  /// The value of each action.
+  std::vector<float> m_values;
+
+  /// The index of the action class of each action in the class table.
+  std::vector<std::uint8_t> m_classIds;
+
+  /// The action classes.
+  std::vector<ActionClass> m_classes;
+
+  /// The total visits of each action class.
+  std::vector<float> m_classVisits;
+
+  /// The average action value within each action class.
+  std::vector<float> m_classValues;
+
+  /// The average UCT score within each action class.
+  std::vector<float> m_classUCT;
+
+  /// The number of actions within each action class.
+  std::vector<int> m_classCount;
+
+ private:
+  void updateValueBounds(const float oldValue, const float newValue);
+
+  void updateClassValue(const std::size_t classId);
+
+  /// The sum of the visits of all actions.
+  float m_totalVisits{0.0f};
+
+  /// The sum of the visit weighted values of the actions within each action class.
+  std::vector<float> m_classValueSums;
+
+  /// The minimum action value, only valid if `m_valueBoundsValid` is set.
+  mutable float m_minValue{0.0f};
+
+  /// The maximum action value, only valid if `m_valueBoundsValid` is set.
+  mutable float m_maxValue{0.0f};
+
+  /// The flag that indicates whether the bounds of the action values are up to date.
+  mutable bool m_valueBoundsValid{true};
+
+  /// The UCT value of each action, only valid if `m_uctValid` is set.
+  mutable std::vector<float> m_uct;
+
+  /// The flag that indicates whether the UCT values are up to date.
+  mutable bool m_uctValid{true};
+
+  /// The exploration constant the UCT values have been evaluated with.
+  mutable float m_uctCp{0.0f};
+};
+}  // namespace proseco_planning
@@ -9,13 +9,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
-#include <map>
 #include <memory>
 #include <vector>
 
 #include "nlohmann/json.hpp"
 using json = nlohmann::json;
 #include "proseco_planning/action/actionClass.h"
+#include "proseco_planning/agent/actionStatistics.h"
 #include "proseco_planning/agent/desire.h"
 #include "proseco_planning/agent/vehicle.h"
 #include "proseco_planning/trajectory/trajectory.h"
@@ -43,6 +43,8 @@ class Agent {
 
   void clearActionMaps();
 
+  void reuseActions(const Agent& agent, unsigned int depth);
+
   void addActionToMaps(const ActionPtr& action);
 
   void addActionsToMaps(const ActionSet& actions);
@@ -51,6 +53,8 @@ class Agent {
 
   void setAction(ActionPtr action, const TrajectoryGenerator& trajectoryGenerator);
 
+  void setAction(const Trajectory& trajectory, const float actionCost);
+
   void simulate();
 
   void calculateCosts(const Vehicle& vehiclePreviousStep, const float beforePotential);
@@ -96,26 +100,8 @@ class Agent {
   /// The action space.
   std::shared_ptr<ActionSpace> m_actionSpace;
 
-  /// The visits of each action.
-  std::map<ActionPtr, float> m_actionVisits;
-
-  /// The value of each action.
-  std::map<ActionPtr, float> m_actionValues;
-
-  /// The UCT value of each action.
-  std::map<ActionPtr, float> m_actionUCT;
-
-  /// The total visits of each action class.
-  std::map<ActionClass, float> m_actionClassVisits;
-
-  /// The average action value within each action class.
-  std::map<ActionClass, float> m_actionClassValues;
-
-  /// The average UCT score within each action class.
-  std::map<ActionClass, float> m_actionClassUCT;
-
-  /// The number of actions within each action class.
-  std::map<ActionClass, int> m_actionClassCount;
+  /// The visits, values and UCT values of the actions and action classes.
+  ActionStatistics m_actionStatistics;
 
   /// The desired state of agent
   Desire m_desire;
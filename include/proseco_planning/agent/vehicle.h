@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <array>
 #include <vector>
 
 #include "nlohmann/json.hpp"
@@ -28,7 +29,7 @@ class Vehicle {
   bool isValid(const float totalVelocity, const float totalacceleration,
                const float steeringAngle) const;
 
-  void updateState(const std::vector<float>& finalState);
+  void updateState(const std::array<float, 8>& finalState);
 
   void setLane(const int lane);
 
@@ -0,0 +1,102 @@
+/**
+ * @file childIndex.h
+ * @brief This file defines the ChildIndex class, the container mapping action sets to child nodes.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+#include "proseco_planning/util/alias.h"
+
+namespace proseco_planning {
+class Node;
+
+/**
+ * @brief The ChildIndex class maps the action sets leading to the children of a node to the child
+ * nodes.
+ * @details The action sets are keyed by the ActionId of the action of each agent, i.e. the index of
+ * the action in the action statistics of the agent at the node. The keys are stored contiguously in
+ * a single pool of ids in insertion order, together with the child nodes and the precomputed hash
+ * of each key. Lookups use a small open addressing table (linear probing) of indices into the
+ * entries, so that finding a child costs one hash of the ids and typically a single comparison of
+ * a few integers, without touching the reference counts of the actions.
+ */
+class ChildIndex {
+ public:
+  using iterator       = std::vector<Node*>::iterator;
+  using const_iterator = std::vector<Node*>::const_iterator;
+
+  static std::size_t hash(const ActionIdSet& actionIds);
+
+  bool insert(const ActionIdSet& actionIds, Node* const child);
+
+  Node* find(const ActionIdSet& actionIds) const;
+
+  Node* at(const ActionIdSet& actionIds) const;
+
+  /**
+   * @brief Returns the number of children reached by the action ids (i.e. 0 or 1).
+   *
+   * @param actionIds The action ids.
+   * @return std::size_t The number of children.
+   */
+  std::size_t count(const ActionIdSet& actionIds) const { return find(actionIds) != nullptr; }
+
+  /**
+   * @brief Returns the action id of an agent in the key of an entry.
+   *
+   * @param index The index of the entry.
+   * @param agentIdx The index of the agent.
+   * @return ActionId The action id.
+   */
+  ActionId actionId(const std::size_t index, const std::size_t agentIdx) const {
+    return m_actionIds[index * m_nAgents + agentIdx];
+  }
+
+  /// The child node of an entry.
+  Node* child(const std::size_t index) const { return m_children[index]; }
+
+  void clear();
+
+  /// The number of children.
+  std::size_t size() const { return m_children.size(); }
+
+  /// Checks whether there are no children.
+  bool empty() const { return m_children.empty(); }
+
+  /// The children in insertion order.
+  iterator begin() { return m_children.begin(); }
+  iterator end() { return m_children.end(); }
+  const_iterator begin() const { return m_children.begin(); }
+  const_iterator end() const { return m_children.end(); }
+
+ private:
+  std::size_t findEntry(const ActionIdSet& actionIds, const std::size_t hash) const;
+
+  void rehash(const std::size_t nSlots);
+
+  /// The marker for empty slots.
+  static constexpr std::uint32_t emptySlot{0};
+
+  /// The number of action ids per key, i.e. the number of agents.
+  std::size_t m_nAgents{0};
+  /// The keys of all entries, `m_nAgents` action ids per entry.
+  std::vector<ActionId> m_actionIds;
+  /// The child node of each entry.
+  std::vector<Node*> m_children;
+  /// The hash of the key of each entry.
+  std::vector<std::size_t> m_hashes;
+  /// The open addressing table, containing the index of the entry + 1 or `emptySlot`.
+  std::vector<std::uint32_t> m_slots;
+};
+
+void to_json(json& j, const ChildIndex& childIndex);
+}  // namespace proseco_planning
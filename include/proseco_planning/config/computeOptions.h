@@ -158,12 +158,81 @@ struct ProgressiveWidening {
   static ProgressiveWidening fromJSON(const json& jProgressiveWidening);
 };
 
+/**
+ * @brief The struct that contains the parameters for reusing the search tree of the previous
+ * planning step.
+ *
+ */
+struct TreeReuse {
+  /// The flag that indicates whether tree reuse is enabled.
+  const bool active;
+  /// The maximum deviation of the observed position from the predicted position [m].
+  const float max_position_drift;
+  /// The maximum deviation of the observed velocity from the predicted velocity [m/s].
+  const float max_velocity_drift;
+  /// The maximum deviation of the observed acceleration from the predicted acceleration [m/s^2].
+  const float max_acceleration_drift;
+  /// The maximum deviation of the observed heading from the predicted heading [rad], the
+  /// difference is wrapped to [-pi, pi].
+  const float max_heading_drift;
+
+  /**
+   * @brief Constructs a new Tree Reuse object.
+   *
+   * @param active The flag that indicates whether tree reuse is enabled.
+   * @param max_position_drift The maximum deviation of the observed position.
+   * @param max_velocity_drift The maximum deviation of the observed velocity.
+   * @param max_acceleration_drift The maximum deviation of the observed acceleration.
+   * @param max_heading_drift The maximum deviation of the observed heading.
+   */
+  TreeReuse(bool active, float max_position_drift, float max_velocity_drift,
+            float max_acceleration_drift, float max_heading_drift)
+      : active(active),
+        max_position_drift(max_position_drift),
+        max_velocity_drift(max_velocity_drift),
+        max_acceleration_drift(max_acceleration_drift),
+        max_heading_drift(max_heading_drift) {}
+
+  json toJSON() const;
+
+  static TreeReuse fromJSON(const json& jTreeReuse);
+};
+
+/**
+ * @brief The struct that contains the parameters for stopping the search early once the best
+ * actions at the root have converged.
+ *
+ */
+struct EarlyStopping {
+  /// The flag that indicates whether early stopping is enabled.
+  const bool active;
+  /// The number of iterations between two convergence checks.
+  const unsigned int check_interval;
+  /// The fraction of the remaining iterations that the lead in visits of the best action of each
+  /// agent over the runner-up has to exceed (1 guarantees that the best actions cannot change).
+  const float budget_fraction;
+
+  /**
+   * @brief Constructs a new Early Stopping object.
+   *
+   * @param active The flag that indicates whether early stopping is enabled.
+   * @param check_interval The number of iterations between two convergence checks.
+   * @param budget_fraction The fraction of the remaining iterations the lead has to exceed.
+   */
+  EarlyStopping(bool active, unsigned int check_interval, float budget_fraction)
+      : active(active), check_interval(check_interval), budget_fraction(budget_fraction) {}
+
+  json toJSON() const;
+
+  static EarlyStopping fromJSON(const json& jEarlyStopping);
+};
+
 /**
  * @brief The struct that contains the parameters for the parallelization of the MCTS.
  *
  */
 struct ParallelizationOptions {
-  /// The number of threads the root parallelization is run with.
+  /// The number of threads the root or tree parallelization is run with.
   const unsigned int n_threads;
   /// The number of threads the leaf parallelization is run with.
   const unsigned int n_simulationThreads;
@@ -173,15 +242,27 @@ struct ParallelizationOptions {
   const float similarity_gamma;
   /// The method for aggregating multiple simulation threads.
   const std::string simulation_aggregation;
+  /// The parallelization of the search with multiple threads, "root" (independent trees that are
+  /// merged at the root) or "tree" (all threads share a single tree).
+  const std::string mode;
+  /// The number of virtual visits (with the lowest action value) that are added to each action
+  /// along the path of an iteration in progress during the tree parallelization.
+  const float virtual_loss;
+  /// The flag for pinning the threads of the thread pool to CPU cores.
+  const bool thread_pinning;
 
   ParallelizationOptions(unsigned int n_threads, unsigned int n_simulationThreads,
                          bool similarity_voting, float similarity_gamma,
-                         std::string simulation_aggregation)
+                         std::string simulation_aggregation, std::string mode, float virtual_loss,
+                         bool thread_pinning)
       : n_threads(n_threads),
         n_simulationThreads(n_simulationThreads),
         similarity_voting(similarity_voting),
         similarity_gamma(similarity_gamma),
-        simulation_aggregation(simulation_aggregation) {}
+        simulation_aggregation(simulation_aggregation),
+        mode(mode),
+        virtual_loss(virtual_loss),
+        thread_pinning(thread_pinning) {}
 
   json toJSON() const;
 
@@ -206,6 +287,10 @@ struct PolicyEnhancements {
   const float action_execution_fraction;
   /// The parameter that determines the sharpness of the sample-exp-q policy.
   const float q_scale;
+  /// The struct storing the parameters for the tree reuse.
+  const TreeReuse tree_reuse;
+  /// The struct storing the parameters for the early stopping.
+  const EarlyStopping early_stopping;
 
   /**
    * @brief Constructs a new Policy Enhancements object.
@@ -216,16 +301,21 @@ struct PolicyEnhancements {
    * @param progressive_widening
    * @param action_execution_fraction
    * @param q_scale
+   * @param tree_reuse
+   * @param early_stopping
    */
   PolicyEnhancements(SimilarityUpdate similarity_update, SearchGuide search_guide,
                      MoveGrouping move_grouping, ProgressiveWidening progressive_widening,
-                     float action_execution_fraction, float q_scale)
+                     float action_execution_fraction, float q_scale, TreeReuse tree_reuse,
+                     EarlyStopping early_stopping)
       : similarity_update(similarity_update),
         search_guide(search_guide),
         move_grouping(move_grouping),
         progressive_widening(progressive_widening),
         action_execution_fraction(action_execution_fraction),
-        q_scale(q_scale) {}
+        q_scale(q_scale),
+        tree_reuse(tree_reuse),
+        early_stopping(early_stopping) {}
 
   json toJSON() const;
 
@@ -427,6 +517,9 @@ struct ComputeOptions {
   /// if > 0, 1) this value acts as the maximum viewing distance & 2) the mcts is performed for
   /// every agent separately instead of in a single (centralized) node tree.
   const float region_of_interest;
+  /// The flag that indicates whether the node arena of the search tree requests transparent huge
+  /// pages.
+  const bool huge_pages;
   /**
    * @brief Constructs a new Compute Options object.
    *
@@ -450,6 +543,7 @@ struct ComputeOptions {
    * @param noise
    * @param action_noise
    * @param region_of_interest
+   * @param huge_pages
    */
   ComputeOptions(unsigned int random_seed, unsigned int n_iterations, float max_scenario_duration,
                  unsigned int max_scenario_steps, float max_step_duration,
@@ -458,7 +552,7 @@ struct ComputeOptions {
                  std::string collision_checker, float safety_distance, std::string end_condition,
                  PolicyOptions policy_options, ParallelizationOptions parallelization_options,
                  std::string trajectory_type, float uct_cp, Noise noise, ActionNoise action_noise,
-                 const float region_of_interest)
+                 const float region_of_interest, const bool huge_pages)
       : random_seed(random_seed),
         n_iterations(n_iterations),
         max_scenario_duration(max_scenario_duration),
@@ -478,7 +572,8 @@ struct ComputeOptions {
         uct_cp(uct_cp),
         noise(noise),
         action_noise(action_noise),
-        region_of_interest(region_of_interest) {}
+        region_of_interest(region_of_interest),
+        huge_pages(huge_pages) {}
 
   json toJSON() const;
 
@@ -38,6 +38,8 @@ extern SearchGuide searchGuide;
 extern MoveGroupingCriteriaPW moveGroupingCriteriaPW;
 extern MoveGrouping moveGrouping;
 extern ProgressiveWidening progressiveWidening;
+extern TreeReuse treeReuse;
+extern EarlyStopping earlyStopping;
 extern PolicyEnhancements policyEnhancements;
 extern PolicyOptions policyOptions;
 extern ParallelizationOptions parallelizationOptions;
@@ -10,9 +10,12 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <iterator>
 #include <map>
 #include <numeric>
 #include <random>
+#include <vector>
 
 namespace proseco_planning {
 namespace math {
@@ -101,6 +104,23 @@ inline float UCT(const float actionValue, const float childVisits, const float p
   return actionValue + c * std::sqrt(std::log(parentVisits) / childVisits);
 }
 
+/**
+ * @brief Calculates the Upper Confidence Bounds for Trees (UCT) with the logarithm of the parent
+ * visits precomputed, e.g. once for all children of a node.
+ *
+ * @param actionValue The average value of that action.
+ * @param childVisits The number of times that action/child has been visited.
+ * @param logParentVisits The logarithm of the number of times that parent has been visited.
+ * @param c The constant that balances exploration and exploitation.
+ * @return float The calculated UCT.
+ */
+inline float UCTFromLog(const float actionValue, const float childVisits,
+                        const float logParentVisits, const float c) {
+  assert(actionValue >= 0 && actionValue <= 1 && "actionValue should be within [0,1]");
+  assert(childVisits > 0 && "UCT undefined for unvisited nodes");
+  return actionValue + c * std::sqrt(logParentVisits / childVisits);
+}
+
 /**
  * @brief Normalizes a value between 0 and 1.
  *
@@ -171,15 +191,16 @@ inline bool isEqual(const T a, const T b, const T epsilon) {
 }
 
 /**
- * @brief Calculates the absolute sum of a vector.
+ * @brief Calculates the absolute sum of a vector or a span.
  *
- * @tparam T The type of the vector.
- * @param vector The vector.
- * @return T The absolute sum of the vector.
+ * @tparam Range The type of the vector or span.
+ * @param range The vector or span.
+ * @return Range::value_type The absolute sum of the elements.
  */
-template <typename T>
-inline T absSum(const std::vector<T>& vector) {
-  return std::transform_reduce(vector.begin(), vector.end(), 0, std::plus<>{},
+template <typename Range>
+inline typename Range::value_type absSum(const Range& range) {
+  using T = typename Range::value_type;
+  return std::transform_reduce(range.begin(), range.end(), 0, std::plus<>{},
                                static_cast<T (*)(T)>(std::abs));
 }
 
@@ -292,6 +313,19 @@ std::vector<U> mapValuesToVector(const std::map<T, U>& map) {
   return vector;
 }
 
+/**
+ * @brief Returns the index of the max element of a vector, the first one in case of ties.
+ *
+ * @tparam T The value type.
+ * @param vector The vector, must not be empty.
+ * @return std::size_t The index of the maximum element.
+ */
+template <class T>
+static std::size_t argmax(const std::vector<T>& vector) {
+  return static_cast<std::size_t>(
+      std::distance(vector.begin(), std::max_element(vector.begin(), vector.end())));
+}
+
 /**
  * @brief Map iterator to the max element of the map.
  *
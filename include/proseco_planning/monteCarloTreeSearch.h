@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -16,14 +17,23 @@
 #include "proseco_planning/policies/selectionPolicy.h"
 #include "proseco_planning/policies/simulationPolicy.h"
 #include "proseco_planning/policies/updatePolicy.h"
+#include "proseco_planning/searchContext.h"
 #include "proseco_planning/util/alias.h"
 
 namespace proseco_planning {
 class Node;
 
-std::unique_ptr<Node> computeTree(std::unique_ptr<Node> root);
+bool isConverged(const Node* const root, std::vector<std::size_t>& bestActions,
+                 const unsigned int remainingIterations,
+                 const std::vector<std::vector<float>>& virtualVisits = {});
 
-ActionSetSequence computeActionSetSequence(std::unique_ptr<Node> rootNode, int step);
+std::unique_ptr<Node> computeTree(std::unique_ptr<Node> root, util::ThreadPool& threadPool);
+
+std::unique_ptr<Node> computeSharedTree(std::unique_ptr<Node> root, const unsigned int nThreads,
+                                        const int step, util::ThreadPool& threadPool);
+
+ActionSetSequence computeActionSetSequence(std::unique_ptr<Node> rootNode, int step,
+                                           SearchContext& context);
 
 void mergeTrees(Node* const master, const Node* const node);
 
@@ -9,8 +9,10 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -18,7 +20,10 @@
 using json = nlohmann::json;
 #include "proseco_planning/agent/agent.h"
 #include "proseco_planning/agent/vehicle.h"
+#include "proseco_planning/childIndex.h"
+#include "proseco_planning/trajectory/trajectoryMemo.h"
 #include "proseco_planning/util/alias.h"
+#include "proseco_planning/util/arena.h"
 
 namespace proseco_planning {
 class CollisionChecker;
@@ -40,18 +45,51 @@ class Node {
 
   explicit Node(const std::vector<config::Agent>& agents);
 
-  Node(const ActionSet& actionSet, Node* const parent);
+  Node(const ActionIdSet& actionIds, Node* const parent);
 
   explicit Node(const Node* node);
 
   bool hasChildren() const;
 
+  Node* addChild(const ActionIdSet& actionIds);
+
   Node* addChild(const ActionSet& actionSet);
 
+  Node* getChild(const ActionIdSet& actionIds) const;
+
   Node* getChild(const ActionSet& actionSet) const;
 
+  Node* findChild(const ActionSet& actionSet) const;
+
+  ActionIdSet findActionIds(const ActionSet& actionSet) const;
+
+  ActionIdSet addActionSet(const ActionSet& actionSet);
+
+  ActionSet actionSet(const ActionIdSet& actionIds) const;
+
+  ActionSet actionSet() const;
+
+  void reserveNodes(const std::size_t nNodes, const bool hugePages);
+
+  bool matchesState(const Node& node, const float maxPositionDrift, const float maxVelocityDrift,
+                    const float maxAccelerationDrift, const float maxHeadingDrift) const;
+
+  void reuseSubtree(const Node* const node, CollisionChecker& collisionChecker,
+                    const TrajectoryGenerator& trajectoryGenerator);
+
+  /// The number of nodes owned by the arena of this node.
+  std::size_t arenaSize() const { return m_nodeArena ? m_nodeArena->size() : 0; }
+
+  /// The number of executed actions of the agents that are shared between the children.
+  std::size_t trajectoryMemoSize() const { return m_trajectoryMemo ? m_trajectoryMemo->size() : 0; }
+
+  TrajectoryMemo::Statistics trajectoryMemoStatistics() const;
+
   void checkCollision(CollisionChecker& collisionChecker);
 
+  void checkAgentCollision(CollisionChecker& collisionChecker,
+                           TrajectoryMemo* const memo = nullptr);
+
   std::tuple<bool, bool> validateInitialization();
 
   bool checkInitForCollisions();
@@ -75,6 +113,9 @@ class Node {
   void executeActions(const ActionSet& actionSet, CollisionChecker& collisionChecker,
                       const TrajectoryGenerator& trajectoryGenerator, const bool executeFraction);
 
+  void memoizeAvailableActions(CollisionChecker& collisionChecker,
+                               const TrajectoryGenerator& trajectoryGenerator);
+
   // json exports
   json childMapToJSON(const ActionSet& bestActionSet) const;
   json permutationMapToJSON(const ActionSet& bestActionSet) const;
@@ -89,8 +130,9 @@ class Node {
   void exportMoveGroups(const int step) const;
   void exportTree(const int step) const;
 
-  // The action set that led to the node.
-  ActionSet m_actionSet;
+  // The ids of the actions that led to the node, referring to the action statistics of the agents
+  // of the parent node.
+  ActionIdSet m_actionIds;
   // parent
   Node* m_parent;
   // agents
@@ -99,8 +141,8 @@ class Node {
   unsigned int m_visits;
   // depth of the node
   unsigned int m_depth;
-  // children map, action set as the index
-  std::map<ActionSet, std::unique_ptr<Node>> m_childMap;
+  // children map, action set as the index, the children are owned by the node arena
+  ChildIndex m_childMap;
 
   // represents a collision state resulting from agents executing actions that cause a collision
   // between at least two agents
@@ -110,10 +152,35 @@ class Node {
   // represents a terminal state resulting from all agents reaching their desired states
   bool m_terminal{false};
 
+  // guards the action statistics and action values of the agents, the visits and the children of
+  // the node while multiple threads build a shared search tree
+  mutable std::mutex m_mutex;
+  // represents a child that has been added to a shared search tree, but whose actions are still
+  // being executed by the expanding thread
+  std::atomic<bool> m_pending{false};
+
   // Calculate probability for invalid/collided node
   static std::tuple<float, float, float> calculateActionStatistics(
-      const std::map<ActionSet, std::unique_ptr<Node>>& childMap, const ActionPtr& action,
-      const int agentIdx);
+      const ChildIndex& childMap, const ActionId actionId, const int agentIdx);
+
+ private:
+  util::Arena<Node>& nodeArena();
+
+  void adoptChild(const Node* const node, CollisionChecker& collisionChecker,
+                  const TrajectoryGenerator& trajectoryGenerator);
+
+  // arena that owns all descendants of this node, only set for the node that created it (usually
+  // the root node)
+  std::unique_ptr<util::Arena<Node>> m_nodeArena;
+  // arena the children of this node are allocated from
+  util::Arena<Node>* m_arena{nullptr};
+
+  // the actions executed by the agents of the children of this node, created with the first child
+  std::unique_ptr<TrajectoryMemo> m_trajectoryMemo;
+
+  // flag that indicates whether actions have been executed from the state of this node, i.e. the
+  // state of the agents no longer equals the state of the parent node
+  bool m_executed{false};
 };
 
 void to_json(json& j, const Node& node);
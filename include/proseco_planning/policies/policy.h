@@ -25,7 +25,7 @@ class Policy {
 
   static ActionPtr getRandomAction(const Agent& agent);
 
-  static void getRandomActionSet(Node* const node);
+  static ActionSet getRandomActionSet(const Node* const node);
 
   static void extractReward(const Node* const node,
                             std::vector<std::vector<float> >& agentsRewards);
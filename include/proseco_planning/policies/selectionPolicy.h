@@ -49,7 +49,7 @@ class SelectionPolicy : public Policy {
 
  protected:
   /**
-   * @brief determine a "best" action set, update the member `m_actionSet` accordingly and descend
+   * @brief determine a "best" action set, update the member `m_actionIds` accordingly and descend
    * to the corresponding "best" child node if this node already exists in the search tree.
    *
    * @param node pointer to the current node of the descent
@@ -59,5 +59,8 @@ class SelectionPolicy : public Policy {
 
   /// calculated action set
   ActionSet m_actionSet;
+
+  /// calculated action ids, i.e. the indices of the actions in the action statistics of the agents
+  ActionIdSet m_actionIds;
 };
 }  // namespace proseco_planning
\ No newline at end of file
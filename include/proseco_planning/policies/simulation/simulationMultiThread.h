@@ -14,12 +14,17 @@
 #include "proseco_planning/policies/simulationPolicy.h"
 
 namespace proseco_planning {
+namespace util {
+class ThreadPool;
+}  // namespace util
+
 /**
  * @brief The SimulationMultiThread class is a multithreaded simulation policy.
  */
 class SimulationMultiThread : public SimulationPolicy {
  public:
-  SimulationMultiThread(const std::string& name, const int agentsSize);
+  SimulationMultiThread(const std::string& name, const int agentsSize,
+                        util::ThreadPool& threadPool);
 
   unsigned int runSimulation(Node* const node, std::vector<std::vector<float>>& agentsRewards,
                              unsigned int maxDepth) override;
@@ -43,5 +48,8 @@ class SimulationMultiThread : public SimulationPolicy {
 
   /// The vector contains a node to simulate from for each thread.
   std::vector<std::unique_ptr<Node>> m_simulationNodes;
+
+  /// The thread pool that runs the simulations.
+  util::ThreadPool& m_threadPool;
 };
 }  // namespace proseco_planning
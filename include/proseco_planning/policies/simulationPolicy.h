@@ -17,6 +17,10 @@
 namespace proseco_planning {
 class Node;
 
+namespace util {
+class ThreadPool;
+}  // namespace util
+
 /*!
  * \brief The SimulationPolicy class is a base class for all simulation policies, i.e. single
  * threaded and multi threaded, as well as random and moderate.
@@ -33,7 +37,8 @@ class SimulationPolicy : public Policy {
   /// The virtual destructor.
   virtual ~SimulationPolicy() = default;
 
-  static std::unique_ptr<SimulationPolicy> createPolicy(const std::string& name, int agentsSize);
+  static std::unique_ptr<SimulationPolicy> createPolicy(const std::string& name, int agentsSize,
+                                                        util::ThreadPool& threadPool);
 
   /**
    * @brief run a simulation from a selected node
@@ -48,7 +53,7 @@ class SimulationPolicy : public Policy {
                                      std::vector<std::vector<float> >& agentsRewards,
                                      unsigned int maxDepth) = 0;
 
-  void setSimulationActionSet(Node* const simulationNode) const;
+  void setSimulationActionSet(const Node* const simulationNode, ActionSet& actionSet) const;
 
   unsigned int simulate(Node* const simulationNode, unsigned int maxDepth,
                         std::vector<std::vector<float> >& agentsRewards);
@@ -24,19 +24,16 @@ class UpdateUCT : public UpdatePolicy {
  public:
   using UpdatePolicy::UpdatePolicy;
 
-  void updateNode(Node* const node, const std::vector<std::vector<float> >& agentsRewards,
-                  int simulatedDepth) override;
+  void updateNode(Node* const node, const std::vector<float>& returns) override;
 
  private:
-  static void updateVisitCount(Node* const node, const ActionPtr& action, const size_t agentIdx,
+  static void updateVisitCount(Node* const node, const size_t actionIdx, const size_t agentIdx,
                                const float increment);
 
-  static void updateActionValue(Node* const node, const ActionPtr& action, const size_t agentIdx,
+  static void updateActionValue(Node* const node, const size_t actionIdx, const size_t agentIdx,
                                 const float return_, const float similarity);
 
-  static void updateStandard(Node* const node,
-                             const std::vector<std::vector<float> >& agentsRewards,
-                             int simulatedDepth);
+  static void updateStandard(Node* const node, const std::vector<float>& returns);
 
   static void updateSimilarity(Node* const node, const ActionPtr& executedAction,
                                const size_t agentIdx, const float return_);
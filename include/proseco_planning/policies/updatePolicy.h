@@ -37,6 +37,9 @@ class UpdatePolicy : public Policy {
   void updateTree(Node* node, const std::vector<std::vector<float> >& agentsRewards,
                   unsigned int simulatedDepth);
 
+  void updateSharedTree(Node* node, const std::vector<std::vector<float> >& agentsRewards,
+                        unsigned int simulatedDepth);
+
   static float discountedReward(const float discount_factor, const int distance,
                                 const float reward);
 
@@ -45,18 +48,20 @@ class UpdatePolicy : public Policy {
                                           const std::vector<std::vector<float> >& rewards,
                                           const int agent_idx);
 
+  static void cumulativeDiscountedRewards(const float discount_factor, const int simulation_depth,
+                                          const std::vector<std::vector<float> >& rewards,
+                                          std::vector<std::vector<float> >& returns);
+
   /**
    * @brief Updates the current node of the search tree ascent.
    *
    * @param node Pointer to the current node of the search tree ascent.
-   * @param agentsRewards Vector that contains for every step along the tree path another vector
-   * that stores the reward for each agent.
-   * @param simulatedDepth Depth of the simulation.
+   * @param returns The return of each agent from the depth of the node to the simulated depth.
    */
-  virtual void updateNode(Node* node, const std::vector<std::vector<float> >& agentsRewards,
-                          int simulatedDepth) = 0;
+  virtual void updateNode(Node* node, const std::vector<float>& returns) = 0;
 
- protected:
-  static void updateActionUCT(Agent& agent);
+ private:
+  /// The return of each agent for each step along the tree path, reused between iterations.
+  std::vector<std::vector<float> > m_returns;
 };
 }  // namespace proseco_planning
\ No newline at end of file
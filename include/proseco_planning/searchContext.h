@@ -0,0 +1,83 @@
+/**
+ * @file searchContext.h
+ * @brief This file defines the SearchContext class, the state of the search that outlives a single
+ * planning step.
+ * @copyright Copyright (c) 2021
+ *
+ */
+#pragma once
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "proseco_planning/trajectory/trajectoryMemo.h"
+#include "proseco_planning/util/alias.h"
+#include "proseco_planning/util/threadPool.h"
+
+namespace proseco_planning {
+class Node;
+
+namespace config {
+struct ParallelizationOptions;
+}  // namespace config
+
+/**
+ * @brief The SearchContext class holds the state of the search that outlives a single planning
+ * step, i.e. the thread pool and the search tree retained for the tree reuse. It is owned by the
+ * planner and passed to every planning step.
+ */
+class SearchContext {
+ public:
+  explicit SearchContext(const config::ParallelizationOptions& parallelizationOptions);
+
+  SearchContext(const SearchContext&) = delete;
+  SearchContext& operator=(const SearchContext&) = delete;
+
+  ~SearchContext();
+
+  std::unique_ptr<Node> reuseTree(std::unique_ptr<Node> rootNode, int step);
+
+  void retainTree(std::unique_ptr<Node> root, const ActionSet& actionSet, int step);
+
+  void resetTreeReuse();
+
+  void releaseTrees(std::vector<std::unique_ptr<Node>> roots);
+
+  void waitForRelease();
+
+  /// The thread pool that runs the parallel work of the search.
+  util::ThreadPool& threadPool() { return m_threadPool; }
+
+  /**
+   * @brief Returns the number of iterations that have been run in the last planning step, summed
+   * over all search trees in case of root parallelization. It falls below the configured number of
+   * iterations if the search has been stopped early or the maximum step duration has been reached.
+   *
+   * @return unsigned int The number of iterations.
+   */
+  unsigned int lastIterationCount() const { return m_lastIterationCount; }
+
+  /// Sets the number of iterations of the last planning step.
+  void setLastIterationCount(const unsigned int nIterations) { m_lastIterationCount = nIterations; }
+
+  TrajectoryMemo::Statistics memoStatistics();
+
+ private:
+  /// The thread pool, sized for the parallelization options at construction.
+  util::ThreadPool m_threadPool;
+  /// The search tree of the previous planning step that is retained for the tree reuse.
+  std::unique_ptr<Node> m_previousTree;
+  /// The action set that has been selected for execution in the previous planning step.
+  ActionSet m_previousActionSet;
+  /// The previous planning step.
+  int m_previousStep{-1};
+  /// The task that releases the search trees of the previous planning step.
+  std::future<void> m_release;
+  /// The number of iterations of the last planning step.
+  unsigned int m_lastIterationCount{0};
+  /// The lookup statistics of the trajectory memos of all released search trees, written by the
+  /// pending release.
+  TrajectoryMemo::Statistics m_memoStatistics;
+};
+}  // namespace proseco_planning
@@ -6,7 +6,6 @@
  */
 #pragma once
 
-#include <map>
 #include <memory>
 #include <string>
 
@@ -15,6 +14,7 @@
 
 namespace proseco_planning {
 class ActionSpace;
+class ActionStatistics;
 class Vehicle;
 
 /**
@@ -38,12 +38,12 @@ class SearchGuide {
 
    * @param actionSpace The action space.
    * @param vehicle The current state of the vehicle.
-   * @param actionUCT UCT values for all available actions.
+   * @param actionStatistics The statistics (e.g. the UCT values) of all available actions.
    * @return ActionPtr To the best action for progressive widening.
    *
    */
   virtual ActionPtr getBestActionForPW(const ActionSpace& actionSpace, const Vehicle& vehicle,
-                                       const std::map<ActionPtr, float>& actionUCT) const = 0;
+                                       const ActionStatistics& actionStatistics) const = 0;
 
   /**
    * @brief Get the best action whithin an specified action class that shall be appended to the
@@ -52,13 +52,13 @@ class SearchGuide {
    * @param actionClass The action class.
    * @param actionSpace The action space.
    * @param vehicle The current state of the vehicle.
-   * @param actionUCT UCT values for all available actions.
+   * @param actionStatistics The statistics (e.g. the UCT values) of all available actions.
    * @return ActionPtr To the best action for progressive widening.
    *
    */
   virtual ActionPtr getBestActionInActionClassForPW(
       const ActionClass& actionClass, const ActionSpace& actionSpace, const Vehicle& vehicle,
-      const std::map<ActionPtr, float>& actionUCT) const = 0;
+      const ActionStatistics& actionStatistics) const = 0;
 
   /// The type of search guide.
   std::string m_type;
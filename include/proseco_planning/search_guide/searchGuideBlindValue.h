@@ -18,6 +18,7 @@
 
 namespace proseco_planning {
 class ActionSpace;
+class ActionStatistics;
 class Vehicle;
 
 /**
@@ -33,14 +34,14 @@ class SearchGuideBlindValue : public SearchGuide {
    *
    * @param actionSpace The action space of the agent.
    * @param vehicle The vehicle.
-   * @param actionUCT The UCT values for all available actions.
+   * @param actionStatistics The statistics (e.g. the UCT values) of all available actions.
    * @return ActionPtr The best action for progressive widening.
    */
   inline ActionPtr getBestActionForPW(const ActionSpace& actionSpace, const Vehicle& vehicle,
-                                      const std::map<ActionPtr, float>& actionUCT) const override {
+                                      const ActionStatistics& actionStatistics) const override {
     // `ActionClass::NONE` as the argument for `actionClass` means that the entire action space is
     // considered
-    return getBestActionForPW(ActionClass::NONE, actionSpace, vehicle, actionUCT);
+    return getBestActionForPW(ActionClass::NONE, actionSpace, vehicle, actionStatistics);
   };
 
   /**
@@ -49,26 +50,26 @@ class SearchGuideBlindValue : public SearchGuide {
    * @param actionClass The action class.
    * @param actionSpace The action space of the agent.
    * @param vehicle The vehicle.
-   * @param actionUCT The UCT values for all available actions.
+   * @param actionStatistics The statistics (e.g. the UCT values) of all available actions.
    * @return ActionPtr The best action for progressive widening.
    */
   inline ActionPtr getBestActionInActionClassForPW(
       const ActionClass& actionClass, const ActionSpace& actionSpace, const Vehicle& vehicle,
-      const std::map<ActionPtr, float>& actionUCT) const override {
+      const ActionStatistics& actionStatistics) const override {
     assert((actionClass != ActionClass::NONE) && "actionClass is ActionClass::NONE");
     // `actionClass` is forwarded so that only the this action class is considered
-    return getBestActionForPW(actionClass, actionSpace, vehicle, actionUCT);
+    return getBestActionForPW(actionClass, actionSpace, vehicle, actionStatistics);
   };
 
  protected:
   ActionPtr getBestActionForPW(const ActionClass& actionClass, const ActionSpace& actionSpace,
                                const Vehicle& vehicle,
-                               const std::map<ActionPtr, float>& actionUCT) const;
+                               const ActionStatistics& actionStatistics) const;
 
   static float calculateBlindValue(const float adaptionCoefficient, const ActionPtr& newAction,
-                                   const std::map<ActionPtr, float>& exploredActions);
+                                   const ActionStatistics& exploredActions);
 
-  static float calculateAdaptionCoefficient(const std::map<ActionPtr, float>& actionUCT,
+  static float calculateAdaptionCoefficient(const ActionStatistics& actionStatistics,
                                             const std::map<ActionPtr, float>& newActions);
 
   static std::map<ActionPtr, float> sampleRandomActions(const ActionClass& actionClass,
@@ -7,14 +7,13 @@
 
 #pragma once
 
-#include <map>
-
 #include "proseco_planning/action/actionClass.h"
 #include "proseco_planning/util/alias.h"
 #include "searchGuide.h"
 
 namespace proseco_planning {
 class ActionSpace;
+class ActionStatistics;
 class Vehicle;
 
 /**
@@ -26,10 +25,10 @@ class SearchGuideRandom : public SearchGuide {
   using SearchGuide::SearchGuide;
 
   ActionPtr getBestActionForPW(const ActionSpace& actionSpace, const Vehicle& vehicle,
-                               const std::map<ActionPtr, float>& actionUCT) const override;
+                               const ActionStatistics& actionStatistics) const override;
 
   ActionPtr getBestActionInActionClassForPW(
       const ActionClass& actionClass, const ActionSpace& actionSpace, const Vehicle& vehicle,
-      const std::map<ActionPtr, float>& actionUCT) const override;
+      const ActionStatistics& actionStatistics) const override;
 };
 }  // namespace proseco_planning
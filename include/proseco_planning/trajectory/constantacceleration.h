@@ -32,6 +32,10 @@ class ConstantAcceleration : public TrajectoryGenerator {
                                  const BoundaryCondition& endS,
                                  const BoundaryCondition& endD) const override;
 
+  void calculateTrajectories(const Vehicle& vehicle, const float t0,
+                             const std::vector<BoundaryConditions>& boundaryConditions,
+                             std::vector<Trajectory>& trajectories) const override;
+
   void updateFinalState(Trajectory& trajectory) const override;
 
   void calculateCumulativeAcceleration(Trajectory& trajectory, const BoundaryCondition& startS,
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -17,6 +18,59 @@
 namespace proseco_planning {
 class Trajectory;
 class Vehicle;
+
+/**
+ * @brief The QuinticBasis struct holds the precomputed maps of the fifth order polynomials with a
+ * start time of zero and a fixed duration.
+ * @details The first three coefficients equal the start constraints (position, velocity, half the
+ * acceleration), the remaining three are a linear map of the residuals of the end constraints. The
+ * integral of the squared acceleration is a quadratic form of the coefficients. Both maps only
+ * depend on the duration and replace the LU decomposition of the constraint matrix.
+ */
+struct QuinticBasis {
+  explicit QuinticBasis(const float duration);
+
+  Eigen::Matrix<float, 1, 6> coefficients(const Eigen::Matrix<float, 1, 6>& constraints) const;
+
+  float squaredAccelerationIntegral(const Eigen::Matrix<float, 1, 6>& coeff) const;
+
+  static Eigen::Matrix4f accelerationGramMatrix(const float t_0, const float t_1);
+
+  /// The duration of the polynomials.
+  float m_duration;
+
+  /// The map from the residuals of the end constraints to the coefficients of t^3, t^4 and t^5.
+  Eigen::Matrix3f m_endToCoefficients;
+
+  /// The Gram matrix of the acceleration basis {2, 6t, 12t^2, 20t^3} over [0, duration].
+  Eigen::Matrix4f m_accelerationGram;
+};
+
+/**
+ * @brief The SampleBasis struct holds the monomials of the fifth order polynomials and their
+ * derivatives at the sample times of a trajectory. The samples of the position, velocity and
+ * acceleration are the products of the coefficients with the respective basis.
+ */
+struct SampleBasis {
+  SampleBasis(const float t0, const float deltaT, const std::size_t nSteps);
+
+  /// The start time of the trajectory.
+  float m_t0;
+
+  /// The time between two samples.
+  float m_deltaT;
+
+  /// The number of samples.
+  std::size_t m_nSteps;
+
+  ///@{
+  /// The basis with a column for each sample.
+  Eigen::Matrix<float, 6, Eigen::Dynamic> m_position;
+  Eigen::Matrix<float, 6, Eigen::Dynamic> m_velocity;
+  Eigen::Matrix<float, 6, Eigen::Dynamic> m_acceleration;
+  ///@}
+};
+
 /*
  * @brief The PolynomialGenerator class defines the polynomial trajectory generator.
  * @details It uses 5th order polynomials in both lateral and longitudinal direction.
@@ -24,12 +78,15 @@ class Vehicle;
 
 class PolynomialGenerator : public TrajectoryGenerator {
  public:
-  using TrajectoryGenerator::TrajectoryGenerator;
+  explicit PolynomialGenerator(const std::string& name);
 
  private:
   Eigen::Matrix<float, 1, 6> calculate_coefficients(const Eigen::Matrix<float, 1, 6>& constraints,
                                                     float t_0, float t_1) const;
 
+  Eigen::Matrix<float, 1, 6> solve_coefficients(const Eigen::Matrix<float, 1, 6>& constraints,
+                                                float t_0, float t_1) const;
+
   Eigen::Matrix<float, 1, 6> boundaryConditionsToEigenMatrix(const BoundaryCondition& start,
                                                              const BoundaryCondition& end) const;
 
@@ -42,18 +99,12 @@ class PolynomialGenerator : public TrajectoryGenerator {
   float calculate_heading(const Trajectory& trajectory, const size_t i,
                           const Vehicle& vehicle) const;
 
-  float calculate_curvature(const Trajectory& trajectory, const size_t i) const;
-
-  float calculate_steering_angle(const Trajectory& trajectory, const size_t i,
-                                 const Vehicle& vehicle) const;
-
-  float calculate_total_velocity(const Trajectory& trajectory, const size_t i) const;
-
-  float calculate_total_acceleration(const Trajectory& trajectory, const size_t i) const;
-
   float squared_acceleration_integral(const BoundaryCondition& start, const BoundaryCondition& end,
                                       const float t_0, const float t_1) const;
 
+  float squared_acceleration_integral(const Eigen::Matrix<float, 1, 6>& coeff, const float t_0,
+                                      const float t_1) const;
+
   std::tuple<BoundaryCondition, BoundaryCondition, BoundaryCondition, BoundaryCondition>
   createBoundaryConditions(ActionPtr action, const Vehicle& vehicle) const override;
 
@@ -62,11 +113,23 @@ class PolynomialGenerator : public TrajectoryGenerator {
                                  const BoundaryCondition& endS,
                                  const BoundaryCondition& endD) const override;
 
+  void calculateTrajectories(const Vehicle& vehicle, const float t0,
+                             const std::vector<BoundaryConditions>& boundaryConditions,
+                             std::vector<Trajectory>& trajectories) const override;
+
+  void calculate_vehicle_states(Trajectory& trajectory, const Vehicle& vehicle) const;
+
   void updateFinalState(Trajectory& trajectory) const override;
 
   void calculateCumulativeAcceleration(Trajectory& trajectory, const BoundaryCondition& startS,
                                        const BoundaryCondition& startD,
                                        const BoundaryCondition& endS,
                                        const BoundaryCondition& endD) const override;
+
+  /// The basis for the duration of an action, precomputed for the configuration at construction.
+  const QuinticBasis m_basis;
+
+  /// The basis at the sample times of a trajectory starting at zero, precomputed at construction.
+  const SampleBasis m_sampleBasis;
 };
 }  // namespace proseco_planning
\ No newline at end of file
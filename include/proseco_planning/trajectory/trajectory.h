@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
-#include <vector>
+#include <memory>
+#include <span>
 
 #include "nlohmann/json.hpp"
 using json = nlohmann::json;
@@ -19,12 +21,28 @@ class Vehicle;
 
 /**
  * @brief The Trajectory class defines the trajectory of a vehicle.
- *
+ * @details The values at each time step are stored field by field in a single block, which is part
+ * of the trajectory itself for up to `inlineSteps` steps and allocated on the heap otherwise. The
+ * fields are accessed through spans into the block, so copying a trajectory of the default length
+ * does not allocate.
  */
 class Trajectory {
  public:
+  /// The maximum number of steps stored within the trajectory itself, i.e. without allocation.
+  static constexpr std::size_t inlineSteps{21};
+
   Trajectory(const float t0, const float initialHeading);
 
+  Trajectory(const Trajectory& other);
+
+  Trajectory(Trajectory&& other) noexcept;
+
+  Trajectory& operator=(const Trajectory& other);
+
+  Trajectory& operator=(Trajectory&& other) noexcept;
+
+  void reset(const float t0, const float initialHeading);
+
   size_t getFractionIndex() const;
 
   static float getCurrentFraction();
@@ -56,24 +74,24 @@ class Trajectory {
   size_t m_nSteps;
 
   ///@{
-  /// A vector that contains the values of the trajectory at each time step.
-  std::vector<float> m_time;
-  std::vector<float> m_sPosition;
-  std::vector<float> m_dPosition;
-  std::vector<float> m_sVelocity;
-  std::vector<float> m_dVelocity;
-  std::vector<float> m_sAcceleration;
-  std::vector<float> m_dAcceleration;
-  std::vector<float> m_curvature;
-  std::vector<int> m_lane;
-  std::vector<float> m_heading;
-  std::vector<float> m_steeringAngle;
-  std::vector<float> m_totalVelocity;
-  std::vector<float> m_totalAcceleration;
+  /// A span that contains the values of the trajectory at each time step.
+  std::span<float> m_time;
+  std::span<float> m_sPosition;
+  std::span<float> m_dPosition;
+  std::span<float> m_sVelocity;
+  std::span<float> m_dVelocity;
+  std::span<float> m_sAcceleration;
+  std::span<float> m_dAcceleration;
+  std::span<float> m_curvature;
+  std::span<int> m_lane;
+  std::span<float> m_heading;
+  std::span<float> m_steeringAngle;
+  std::span<float> m_totalVelocity;
+  std::span<float> m_totalAcceleration;
   ///@}
 
   /// The final state for updating the vehicle's state.
-  std::vector<float> m_finalState{std::vector<float>(8)};
+  std::array<float, 8> m_finalState{};
 
   /// The average speed in current scenario -- [m/s].
   float m_averageVelocity{0.0f};
@@ -99,6 +117,31 @@ class Trajectory {
 
   /// The flag indicates whether the trajectory results in an invalid state.
   bool m_invalidState{false};
+
+ private:
+  /// The number of fields with floating point values.
+  static constexpr std::size_t nFloatFields{12};
+
+  void allocate(const std::size_t nSteps);
+
+  void copyFrom(const Trajectory& other);
+
+  void bindFields();
+
+  /// The values of the floating point fields of a trajectory with up to `inlineSteps` steps.
+  std::array<float, nFloatFields * inlineSteps> m_inlineValues;
+
+  /// The lanes of a trajectory with up to `inlineSteps` steps.
+  std::array<int, inlineSteps> m_inlineLanes;
+
+  /// The values of the floating point fields of a longer trajectory.
+  std::unique_ptr<float[]> m_heapValues;
+
+  /// The lanes of a longer trajectory.
+  std::unique_ptr<int[]> m_heapLanes;
+
+  /// The number of steps the heap storage can hold.
+  std::size_t m_heapSteps{0};
 };
 void to_json(json& j, const Trajectory& trajectory);
 }  // namespace proseco_planning
@@ -0,0 +1,99 @@
+/**
+ * @file trajectoryMemo.h
+ * @brief This file defines the TrajectoryMemo class, the memo of the executed actions of the agents
+ * at a node.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "proseco_planning/trajectory/trajectory.h"
+#include "proseco_planning/util/alias.h"
+
+namespace proseco_planning {
+
+/**
+ * @brief The TrajectoryMemo class stores the results of executing the actions of the agents from
+ * the state of a node, keyed by the index of the agent and the ActionId of the action.
+ * @details The trajectory of an agent, the cost of its action and whether it collides with an
+ * obstacle only depend on the state of the agent at the node and the action. All children of a node
+ * that share the action of an agent can therefore reuse the result of the first child that
+ * executed it. The same holds for the result of the collision check between two agents, keyed by
+ * both agents and their actions. Entries are never removed, pointers to entries stay valid for the
+ * lifetime of the memo. The memo is safe to use from multiple threads.
+ */
+class TrajectoryMemo {
+ public:
+  /**
+   * @brief The Entry struct holds the result of executing an action of an agent.
+   */
+  struct Entry {
+    /// The trajectory of the agent.
+    Trajectory trajectory;
+    /// The cost of the action.
+    float actionCost;
+    /// The flag that indicates whether the trajectory collides with an obstacle.
+    bool obstacleCollision;
+  };
+
+  /**
+   * @brief The Statistics struct holds the number of lookups that have been answered by a memo
+   * (hits) and the number of lookups that required a computation (misses).
+   */
+  struct Statistics {
+    /// The hits of the trajectory lookups.
+    std::size_t trajectoryHits{0};
+    /// The misses of the trajectory lookups.
+    std::size_t trajectoryMisses{0};
+    /// The hits of the collision lookups.
+    std::size_t collisionHits{0};
+    /// The misses of the collision lookups.
+    std::size_t collisionMisses{0};
+
+    Statistics& operator+=(const Statistics& other);
+  };
+
+  explicit TrajectoryMemo(const std::size_t nAgents);
+
+  const Entry* find(const std::size_t agentIdx, const ActionId actionId) const;
+
+  const Entry* insert(const std::size_t agentIdx, const ActionId actionId, Entry entry);
+
+  std::optional<bool> findCollision(const std::size_t agentIdx0, const ActionId actionId0,
+                                    const std::size_t agentIdx1, const ActionId actionId1) const;
+
+  void insertCollision(const std::size_t agentIdx0, const ActionId actionId0,
+                       const std::size_t agentIdx1, const ActionId actionId1,
+                       const bool collision);
+
+  std::size_t size() const;
+
+  Statistics statistics() const;
+
+ private:
+  std::uint64_t collisionKey(const std::size_t agentIdx0, const ActionId actionId0,
+                             const std::size_t agentIdx1, const ActionId actionId1) const;
+
+  /// The mutex protecting the entries and the statistics.
+  mutable std::mutex m_mutex;
+
+  /// The entries of each agent, indexed by the ActionId of the action.
+  std::vector<std::vector<std::unique_ptr<const Entry>>> m_entries;
+
+  /// The results of the collision checks between two agents.
+  std::unordered_map<std::uint64_t, bool> m_collisions;
+
+  /// The lookup statistics of this memo, protected by the mutex of the entries.
+  mutable Statistics m_statistics;
+};
+}  // namespace proseco_planning
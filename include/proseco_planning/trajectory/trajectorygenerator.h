@@ -33,6 +33,11 @@ struct BoundaryCondition {
   float acceleration{0.0f};
 };
 
+/// The boundary conditions of a trajectory, i.e. the start conditions in longitudinal and lateral
+/// direction and then the end conditions in longitudinal and lateral direction.
+using BoundaryConditions =
+    std::tuple<BoundaryCondition, BoundaryCondition, BoundaryCondition, BoundaryCondition>;
+
 /*
  * @brief The TrajectoryGenerator class defines the base class for all trajectory generators.
  */
@@ -48,6 +53,12 @@ class TrajectoryGenerator {
 
   Trajectory createTrajectory(float t0, ActionPtr action, const Vehicle& vehicle) const;
 
+  std::vector<Trajectory> createTrajectories(float t0, const ActionSet& actions,
+                                             const Vehicle& vehicle) const;
+
+  void createTrajectories(float t0, const ActionSet& actions, const Vehicle& vehicle,
+                          std::vector<Trajectory>& trajectories) const;
+
   /// The name of the method for trajectory generation.
   std::string m_name;
 
@@ -61,6 +72,10 @@ class TrajectoryGenerator {
                                          const BoundaryCondition& endS,
                                          const BoundaryCondition& endD) const = 0;
 
+  virtual void calculateTrajectories(const Vehicle& vehicle, const float t0,
+                                     const std::vector<BoundaryConditions>& boundaryConditions,
+                                     std::vector<Trajectory>& trajectories) const;
+
   virtual void updateFinalState(Trajectory& trajectory) const = 0;
 
   virtual void evaluateTrajectory(Trajectory& trajectory, const BoundaryCondition& startS,
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -21,4 +22,10 @@ using ActionSet = std::vector<ActionPtr>;
 /// An ActionSetSequence is a vector of ActionSet.
 using ActionSetSequence = std::vector<ActionSet>;
 
+/// An ActionId is the index of an action in the action statistics of an agent at a node.
+using ActionId = std::uint32_t;
+
+/// An ActionIdSet contains the ActionId of the action of each agent.
+using ActionIdSet = std::vector<ActionId>;
+
 }  // namespace proseco_planning
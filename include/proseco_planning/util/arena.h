@@ -0,0 +1,155 @@
+/**
+ * @file arena.h
+ * @brief This file defines the Arena class, a slab allocator for objects with a common lifetime.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace proseco_planning::util {
+
+void* allocateSlab(const std::size_t bytes, const bool hugePages);
+
+void freeSlab(void* slab, const std::size_t bytes, const bool hugePages);
+
+/**
+ * @brief The Arena class is a bump allocator that carves objects of type T out of large slabs.
+ * @details All objects share the lifetime of the arena: they are never freed individually but
+ * destroyed in a single linear sweep when the arena is cleared or destroyed. This replaces one heap
+ * allocation per object with one allocation per slab.
+ *
+ * @tparam T The type of the objects stored in the arena.
+ */
+template <typename T>
+class Arena {
+ public:
+  /**
+   * @brief Constructs an arena.
+   *
+   * @param slabCapacity The number of objects per slab.
+   * @param hugePages Flag for requesting transparent huge pages as backing for the slabs.
+   */
+  explicit Arena(const std::size_t slabCapacity = 1024, const bool hugePages = false)
+      : m_slabCapacity(slabCapacity == 0 ? 1 : slabCapacity), m_hugePages(hugePages) {}
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  ~Arena() { clear(); }
+
+  /**
+   * @brief Constructs a new object in the arena.
+   * @details Multiple threads may create objects concurrently, only the reservation of the memory
+   * is serialized, the objects are constructed outside of the lock.
+   *
+   * @tparam Args The types of the constructor arguments.
+   * @param args The constructor arguments.
+   * @return T* The pointer to the new object, owned by the arena.
+   */
+  template <typename... Args>
+  T* create(Args&&... args) {
+    std::byte* memory{nullptr};
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_slabs.empty() || m_used == m_slabCapacity) {
+        addSlab();
+      }
+      memory = m_slabs.back() + m_used * sizeof(T);
+      ++m_used;
+      ++m_size;
+    }
+    try {
+      return new (memory) T(std::forward<Args>(args)...);
+    } catch (...) {
+      // the memory stays reserved, but must not be destroyed
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_unconstructed.push_back(memory);
+      throw;
+    }
+  }
+
+  /**
+   * @brief Ensures that at least `capacity` objects can be created without allocating a new slab.
+   * @note Only increases the capacity of slabs that are yet to be allocated.
+   *
+   * @param capacity The number of objects.
+   */
+  void reserve(const std::size_t capacity) {
+    if (m_slabs.empty() && capacity > m_slabCapacity) {
+      m_slabCapacity = capacity;
+    }
+  }
+
+  /**
+   * @brief Destroys all objects and releases the memory of all slabs.
+   * @details Trivially destructible objects are not visited at all, the slabs are released in bulk.
+   *
+   */
+  void clear() {
+    for (std::size_t slab = 0; slab < m_slabs.size(); ++slab) {
+      if constexpr (!std::is_trivially_destructible_v<T>) {
+        const std::size_t count{slab + 1 == m_slabs.size() ? m_used : m_slabCapacities[slab]};
+        for (std::size_t i = 0; i < count; ++i) {
+          auto memory = m_slabs[slab] + i * sizeof(T);
+          if (!m_unconstructed.empty() && std::find(m_unconstructed.begin(), m_unconstructed.end(),
+                                                    memory) != m_unconstructed.end()) {
+            continue;
+          }
+          std::launder(reinterpret_cast<T*>(memory))->~T();
+        }
+      }
+      freeSlab(m_slabs[slab], m_slabCapacities[slab] * sizeof(T), m_hugePages);
+    }
+    m_slabs.clear();
+    m_slabCapacities.clear();
+    m_unconstructed.clear();
+    m_used = 0;
+    m_size = 0;
+  }
+
+  /// The number of objects in the arena.
+  std::size_t size() const { return m_size; }
+
+  /// The number of slabs allocated by the arena.
+  std::size_t slabs() const { return m_slabs.size(); }
+
+ private:
+  /**
+   * @brief Allocates a new slab with the current slab capacity.
+   *
+   */
+  void addSlab() {
+    auto slab = allocateSlab(m_slabCapacity * sizeof(T), m_hugePages);
+    m_slabs.push_back(static_cast<std::byte*>(slab));
+    m_slabCapacities.push_back(m_slabCapacity);
+    m_used = 0;
+  }
+
+  /// The number of objects per slab.
+  std::size_t m_slabCapacity;
+  /// Flag for requesting huge page backing.
+  const bool m_hugePages;
+  /// The slabs holding the objects.
+  std::vector<std::byte*> m_slabs;
+  /// The capacity of each slab.
+  std::vector<std::size_t> m_slabCapacities;
+  /// The number of objects in the last slab.
+  std::size_t m_used{0};
+  /// The number of objects in the arena.
+  std::size_t m_size{0};
+  /// The memory of objects whose construction has failed.
+  std::vector<std::byte*> m_unconstructed;
+  /// The mutex that serializes the reservation of memory.
+  std::mutex m_mutex;
+};
+}  // namespace proseco_planning::util
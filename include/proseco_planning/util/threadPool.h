@@ -0,0 +1,152 @@
+/**
+ * @file threadPool.h
+ * @brief This file defines the ThreadPool class, a persistent work-stealing pool of worker threads.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace proseco_planning::util {
+
+/**
+ * @brief The ThreadPool class runs tasks on a fixed set of long-lived worker threads.
+ * @details Every worker owns a task queue. Workers take tasks from the back of their own queue and,
+ * once it is empty, steal from the front of the queues of the other workers. Tasks submitted by a
+ * worker are pushed to its own queue, tasks submitted by other threads are distributed round-robin.
+ * This avoids spawning threads (or opening parallel regions) for every planning step or iteration.
+ * The pool is owned by the search context of the planner, see `SearchContext`.
+ */
+class ThreadPool {
+ public:
+  ThreadPool(const unsigned int nThreads, const bool pinning);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool();
+
+  /**
+   * @brief Submits a task to the pool.
+   * @note The returned future must not be waited on from within a task of the same pool, as the
+   * waiting worker cannot run other tasks in the meantime; use `ThreadPool::parallelFor` instead.
+   *
+   * @tparam F The type of the callable.
+   * @param function The callable, invoked without arguments.
+   * @return std::future<std::invoke_result_t<F>> The future of the result of the callable.
+   */
+  template <typename F>
+  std::future<std::invoke_result_t<F>> submit(F&& function) {
+    // std::function requires copyable callables, hence the packaged task is shared
+    auto task = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(
+        std::forward<F>(function));
+    auto future = task->get_future();
+    push([task] { (*task)(); });
+    return future;
+  }
+
+  /**
+   * @brief Invokes `function(i)` for all i in [0, n) on the pool and the calling thread and
+   * returns once all invocations have finished.
+   * @details The calling thread takes part in the work, so that nested calls from within tasks of
+   * the pool cannot deadlock. The first exception thrown by an invocation is rethrown.
+   *
+   * @tparam F The type of the callable.
+   * @param n The number of invocations.
+   * @param function The callable, invoked with the index of the invocation.
+   */
+  template <typename F>
+  void parallelFor(const std::size_t n, F&& function) {
+    if (n == 0) return;
+    // the state outlives this call, as helpers may only start once all indices have been claimed
+    auto state      = std::make_shared<ForState>();
+    state->n        = n;
+    state->function = [&function](const std::size_t i) { function(i); };
+
+    const std::size_t nHelpers{std::min<std::size_t>(n - 1, size())};
+    for (std::size_t h = 0; h < nHelpers; ++h) {
+      push([state] { runFor(*state); });
+    }
+    runFor(*state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&state] { return state->done == state->n; });
+    if (state->exception) std::rethrow_exception(state->exception);
+  }
+
+  /// The number of worker threads.
+  unsigned int size() const { return static_cast<unsigned int>(m_threads.size()); }
+
+  /// Flag for pinning the worker threads to CPU cores.
+  bool pinning() const { return m_pinning; }
+
+ private:
+  /// A task of the pool.
+  using Task = std::function<void()>;
+
+  /// The task queue of a worker.
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  /// The shared state of a `ThreadPool::parallelFor` call.
+  struct ForState {
+    std::size_t n{0};
+    std::function<void(std::size_t)> function;
+    std::atomic<std::size_t> next{0};
+    std::size_t done{0};
+    std::exception_ptr exception;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+
+  static void runFor(ForState& state);
+
+  void push(Task task);
+
+  bool tryPop(const std::size_t index, Task& task);
+
+  void work(const std::size_t index);
+
+  /// The task queue of each worker.
+  std::vector<std::unique_ptr<Queue>> m_queues;
+
+  /// The worker threads.
+  std::vector<std::thread> m_threads;
+
+  /// Flag for pinning the worker threads to CPU cores.
+  const bool m_pinning;
+
+  /// The number of queued tasks.
+  std::atomic<std::size_t> m_pending{0};
+
+  /// The queue for the next task submitted by a thread that is not a worker.
+  std::atomic<std::size_t> m_next{0};
+
+  /// Flag for stopping the workers.
+  bool m_stop{false};
+
+  /// The mutex for sleeping workers.
+  std::mutex m_mutex;
+
+  /// The condition variable for sleeping workers.
+  std::condition_variable m_condition;
+};
+}  // namespace proseco_planning::util
@@ -1,6 +1,7 @@
 #include "proseco_planning/action/action.h"
 
 #include <map>
+#include <memory>
 #include <string>
 
 #include "nlohmann/json.hpp"
@@ -54,6 +55,41 @@ Action::Action(float velocityChange, float lateralChange)
       m_accelerationX(m_velocityChange / cOpt().action_duration),
       m_accelerationY((2 / (cOpt().action_duration * cOpt().action_duration)) * m_lateralChange) {}
 
+/**
+ * @brief Constructs a new Action object as a copy of another action, including its annotation.
+ *
+ * @param action The action to copy.
+ */
+Action::Action(const Action& action)
+    : m_actionClass(action.m_actionClass),
+      m_velocityChange(action.m_velocityChange),
+      m_lateralChange(action.m_lateralChange),
+      m_accelerationX(action.m_accelerationX),
+      m_accelerationY(action.m_accelerationY),
+      m_invalidAction(action.m_invalidAction),
+      m_annotation(action.m_annotation ? std::make_unique<ActionAnnotation>(*action.m_annotation)
+                                       : nullptr) {}
+
+/**
+ * @brief Returns the annotation of the action.
+ *
+ * @return const ActionAnnotation& The annotation, default values if the action is not annotated.
+ */
+const ActionAnnotation& Action::annotation() const {
+  static const ActionAnnotation noAnnotation{};
+  return m_annotation ? *m_annotation : noAnnotation;
+}
+
+/**
+ * @brief Returns the annotation of the action and allocates it on first access.
+ *
+ * @return ActionAnnotation& The annotation.
+ */
+ActionAnnotation& Action::annotation() {
+  if (!m_annotation) m_annotation = std::make_unique<ActionAnnotation>();
+  return *m_annotation;
+}
+
 /**
  * @brief Updates `m_actionClass` according to the action space and the current state of the
  * vehicle.
@@ -1,6 +1,7 @@
 #include "proseco_planning/action/actionSpace.h"
 
 #include <cstddef>
+#include <numeric>
 #include <random>
 #include <stdexcept>
 #include <variant>
@@ -77,4 +78,59 @@ ActionPtr ActionSpace::sampleValidAction(const Vehicle& vehicle,
   return action;
 };
 
+/**
+ * @brief Samples several actions, each of which is resampled like in `sampleValidAction` until it
+ * is valid or the maximum number of invalid samples is reached.
+ * @details The candidates are validated in rounds, the trajectories of all candidates of a round
+ * are created in one batch from the state of the vehicle.
+ *
+ * @param vehicle The current state of the vehicle.
+ * @param samplingFunction The function that samples a single action.
+ * @param nActions The number of actions to sample.
+ * @param collisionChecker The collision checker for the collision check with the obstacles.
+ * @param trajectoryGenerator The trajectory generator.
+ * @return ActionSet The sampled actions.
+ */
+ActionSet ActionSpace::sampleValidActions(const Vehicle& vehicle,
+                                          const std::function<ActionPtr()>& samplingFunction,
+                                          const unsigned int nActions,
+                                          CollisionChecker& collisionChecker,
+                                          const TrajectoryGenerator& trajectoryGenerator) {
+  ActionSet actions(nActions);
+  for (auto& action : actions) {
+    action = samplingFunction();
+  }
+  Trajectory::useActionFraction = false;
+
+  // the indices of the actions that have not been validated yet
+  std::vector<std::size_t> pending(nActions);
+  std::iota(pending.begin(), pending.end(), 0);
+  ActionSet candidates;
+  std::vector<Trajectory> trajectories;
+  for (uint sample = 0;; ++sample) {
+    candidates.clear();
+    for (const auto i : pending) {
+      candidates.push_back(actions[i]);
+    }
+    trajectoryGenerator.createTrajectories(0.0f, candidates, vehicle, trajectories);
+
+    // ensure that the action and state are valid, and that no collision occurs with obstacles
+    std::size_t nInvalid{0};
+    for (std::size_t k = 0; k < pending.size(); ++k) {
+      const auto& trajectory = trajectories[k];
+      if (!trajectory.isValidAction(vehicle) || !trajectory.isValidState(vehicle) ||
+          collisionChecker.collision(vehicle, trajectory, sOpt().obstacles)) {
+        pending[nInvalid++] = pending[k];
+      }
+    }
+    pending.resize(nInvalid);
+    if (pending.empty() || sample == cOpt().max_invalid_action_samples) break;
+
+    for (const auto i : pending) {
+      actions[i] = samplingFunction();
+    }
+  }
+  return actions;
+}
+
 }  // namespace proseco_planning
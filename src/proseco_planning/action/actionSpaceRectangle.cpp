@@ -283,4 +283,35 @@ ActionPtr ActionSpaceRectangle::sampleRandomActionInActionClass(const ActionClas
       *m_collisionChecker, *m_trajectoryGenerator);
 };
 
+/**
+ * @brief Sample several random actions within the action boundary of the action space, validated
+ * in batches.
+ *
+ * @param vehicle The vehicle.
+ * @param nActions The number of actions to sample.
+ * @return ActionSet The sampled actions.
+ */
+ActionSet ActionSpaceRectangle::sampleRandomActions(const Vehicle& vehicle,
+                                                    const unsigned int nActions) const {
+  return sampleValidActions(
+      vehicle, std::bind(&ActionSpaceRectangle::sampleRandomActionInBoundary, m_boundary),
+      nActions, *m_collisionChecker, *m_trajectoryGenerator);
+}
+
+/**
+ * @brief Sample several random actions whithin the specified action class, validated in batches.
+ *
+ * @param actionClass The action class.
+ * @param vehicle The vehicle.
+ * @param nActions The number of actions to sample.
+ * @return ActionSet The sampled actions.
+ */
+ActionSet ActionSpaceRectangle::sampleRandomActionsInActionClass(
+    const ActionClass& actionClass, const Vehicle& vehicle, const unsigned int nActions) const {
+  auto classBoundary = getActionClassBoundary(actionClass, vehicle);
+  return sampleValidActions(
+      vehicle, std::bind(&ActionSpaceRectangle::sampleRandomActionInBoundary, classBoundary),
+      nActions, *m_collisionChecker, *m_trajectoryGenerator);
+}
+
 }  // namespace proseco_planning
@@ -43,13 +43,14 @@ ActionPtr NoiseGenerator::createNoisyAction(const ActionPtr& action) {
   auto noisyAction = std::make_shared<Action>(action->m_velocityChange + epsilonVx,
                                               action->m_lateralChange + epsilonY);
 
-  noisyAction->noise.m_likelihoodY   = likelihoodY;
-  noisyAction->noise.m_likelihoodVx  = likelihoodVx;
-  noisyAction->noise.m_muY           = action->m_lateralChange;
-  noisyAction->noise.m_muVx          = action->m_velocityChange;
-  noisyAction->noise.m_sigmaY        = cOpt().action_noise.sigmaY;
-  noisyAction->noise.m_sigmaVx       = cOpt().action_noise.sigmaVx;
-  noisyAction->m_selectionLikelihood = action->m_selectionLikelihood;
+  auto& annotation                 = noisyAction->annotation();
+  annotation.noise.m_likelihoodY   = likelihoodY;
+  annotation.noise.m_likelihoodVx  = likelihoodVx;
+  annotation.noise.m_muY           = action->m_lateralChange;
+  annotation.noise.m_muVx          = action->m_velocityChange;
+  annotation.noise.m_sigmaY        = cOpt().action_noise.sigmaY;
+  annotation.noise.m_sigmaVx       = cOpt().action_noise.sigmaVx;
+  annotation.m_selectionLikelihood = action->annotation().m_selectionLikelihood;
   return noisyAction;
 }
 
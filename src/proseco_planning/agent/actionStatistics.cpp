@@ -0,0 +1,346 @@
+#include "proseco_planning/agent/actionStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "proseco_planning/action/action.h"
+#include "proseco_planning/config/computeOptions.h"
+#include "proseco_planning/config/configuration.h"
+#include "proseco_planning/math/mathlib.h"
+#include "proseco_planning/util/json.h"
+
+namespace proseco_planning {
+
+/**
+ * @brief Converts the statistics of each key to JSON, using the layout of a `std::map` (i.e. an
+ * array of key value pairs).
+ *
+ * @tparam K The key type.
+ * @tparam V The value type.
+ * @param keys The keys.
+ * @param values The value of each key.
+ * @return json The key value pairs.
+ */
+template <class K, class V>
+static json pairsToJSON(const std::vector<K>& keys, const std::vector<V>& values) {
+  json j = json::array();
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    j.push_back(json::array({keys[i], values[i]}));
+  }
+  return j;
+}
+
+/**
+ * @brief Adds an action with default statistics, unless it already exists. The action class of the
+ * action is added to the class table if necessary.
+ *
+ * @param action The action to add.
+ * @return std::size_t The index of the action.
+ */
+std::size_t ActionStatistics::add(const ActionPtr& action) {
+  if (const auto i = find(action); i != npos) return i;
+
+  auto classId = findClass(action->m_actionClass);
+  if (classId == npos) {
+    classId = m_classes.size();
+    m_classes.push_back(action->m_actionClass);
+    m_classVisits.push_back(0.0f);
+    m_classValues.push_back(0.0f);
+    m_classUCT.push_back(config::ComputeOptions::initial_uct);
+    m_classCount.push_back(0);
+    m_classValueSums.push_back(0.0f);
+  }
+  ++m_classCount[classId];
+
+  // the value of the new action may extend the bounds of the action values
+  if (m_actions.empty()) {
+    m_minValue         = 0.0f;
+    m_maxValue         = 0.0f;
+    m_valueBoundsValid = true;
+  } else if (m_valueBoundsValid) {
+    m_minValue = std::min(m_minValue, 0.0f);
+    m_maxValue = std::max(m_maxValue, 0.0f);
+  }
+
+  m_actions.push_back(action);
+  m_visits.push_back(0.0f);
+  m_values.push_back(0.0f);
+  m_uct.push_back(config::ComputeOptions::initial_uct);
+  m_uctValid = false;
+  m_classIds.push_back(static_cast<std::uint8_t>(classId));
+  return m_actions.size() - 1;
+}
+
+/**
+ * @brief Returns the index of the action.
+ *
+ * @param action The action.
+ * @return std::size_t The index of the action, `npos` if it does not exist.
+ */
+std::size_t ActionStatistics::find(const ActionPtr& action) const {
+  for (std::size_t i = 0; i < m_actions.size(); ++i) {
+    if (m_actions[i] == action) return i;
+  }
+  return npos;
+}
+
+/**
+ * @brief Returns the index of the action.
+ *
+ * @param action The action.
+ * @return std::size_t The index of the action.
+ * @throws std::out_of_range If the action does not exist.
+ */
+std::size_t ActionStatistics::index(const ActionPtr& action) const {
+  const auto i = find(action);
+  if (i == npos) throw std::out_of_range("ActionStatistics: unknown action");
+  return i;
+}
+
+/**
+ * @brief Returns the index of the action class in the class table.
+ *
+ * @param actionClass The action class.
+ * @return std::size_t The index of the action class, `npos` if it does not exist.
+ */
+std::size_t ActionStatistics::findClass(const ActionClass actionClass) const {
+  for (std::size_t i = 0; i < m_classes.size(); ++i) {
+    if (m_classes[i] == actionClass) return i;
+  }
+  return npos;
+}
+
+/**
+ * @brief Returns the index of the action class in the class table.
+ *
+ * @param actionClass The action class.
+ * @return std::size_t The index of the action class.
+ * @throws std::out_of_range If the action class does not exist.
+ */
+std::size_t ActionStatistics::classIndex(const ActionClass actionClass) const {
+  const auto i = findClass(actionClass);
+  if (i == npos) throw std::out_of_range("ActionStatistics: unknown action class");
+  return i;
+}
+
+/**
+ * @brief Removes all actions and action classes.
+ */
+void ActionStatistics::clear() {
+  m_actions.clear();
+  m_visits.clear();
+  m_values.clear();
+  m_classIds.clear();
+  m_classes.clear();
+  m_classVisits.clear();
+  m_classValues.clear();
+  m_classUCT.clear();
+  m_classCount.clear();
+  m_totalVisits = 0.0f;
+  m_classValueSums.clear();
+  m_minValue         = 0.0f;
+  m_maxValue         = 0.0f;
+  m_valueBoundsValid = true;
+  m_uct.clear();
+  m_uctValid = true;
+}
+
+/**
+ * @brief Adds visits to an action and updates the total visits and the statistics of its action
+ * class.
+ *
+ * @param i The index of the action.
+ * @param visits The visits to add (may be fractional, e.g. for the similarity update).
+ */
+void ActionStatistics::addVisits(const std::size_t i, const float visits) {
+  const auto classId{m_classIds[i]};
+  m_visits[i] += visits;
+  m_totalVisits += visits;
+  m_classVisits[classId] += visits;
+  m_classValueSums[classId] += visits * m_values[i];
+  updateClassValue(classId);
+  m_uctValid = false;
+}
+
+/**
+ * @brief Sets the value of an action and updates the bounds of the action values and the
+ * statistics of its action class.
+ *
+ * @param i The index of the action.
+ * @param value The new value.
+ */
+void ActionStatistics::setValue(const std::size_t i, const float value) {
+  const auto classId{m_classIds[i]};
+  const float oldValue{m_values[i]};
+  m_values[i] = value;
+  m_classValueSums[classId] += m_visits[i] * (value - oldValue);
+  updateClassValue(classId);
+  updateValueBounds(oldValue, value);
+  m_uctValid = false;
+}
+
+/**
+ * @brief Recomputes the total visits and the statistics of the action classes from scratch and
+ * marks the bounds of the action values and the UCT values as outdated. Has to be called after
+ * `m_visits` or `m_values` have been written directly.
+ */
+void ActionStatistics::invalidate() {
+  m_totalVisits = 0.0f;
+  std::fill(m_classVisits.begin(), m_classVisits.end(), 0.0f);
+  std::fill(m_classValueSums.begin(), m_classValueSums.end(), 0.0f);
+  for (std::size_t i = 0; i < size(); ++i) {
+    m_totalVisits += m_visits[i];
+    m_classVisits[m_classIds[i]] += m_visits[i];
+    m_classValueSums[m_classIds[i]] += m_visits[i] * m_values[i];
+  }
+  for (std::size_t classId = 0; classId < nClasses(); ++classId) {
+    updateClassValue(classId);
+  }
+  m_valueBoundsValid = false;
+  m_uctValid         = false;
+}
+
+/**
+ * @brief Returns the minimum action value of any action.
+ *
+ * @return float The minimum action value, 0 if there are no actions.
+ */
+float ActionStatistics::minValue() const {
+  if (!m_valueBoundsValid) {
+    const auto [min, max] = std::minmax_element(m_values.begin(), m_values.end());
+    m_minValue            = m_values.empty() ? 0.0f : *min;
+    m_maxValue            = m_values.empty() ? 0.0f : *max;
+    m_valueBoundsValid    = true;
+  }
+  return m_minValue;
+}
+
+/**
+ * @brief Returns the maximum action value of any action.
+ *
+ * @return float The maximum action value, 0 if there are no actions.
+ */
+float ActionStatistics::maxValue() const {
+  minValue();
+  return m_maxValue;
+}
+
+/**
+ * @brief Calculates the UCT value of an action, with the action value normalized to the bounds of
+ * the action values.
+ *
+ * @param i The index of the action.
+ * @param cp The exploration constant.
+ * @param logTotalVisits The logarithm of the total visits.
+ * @return float The UCT value, the initial UCT value if the action has not been visited yet.
+ */
+float ActionStatistics::uctScore(const std::size_t i, const float cp,
+                                 const float logTotalVisits) const {
+  const float minValue{this->minValue()};
+  const float maxValue{m_maxValue};
+  // If the visit count is less than 0.99 the action has not been visited yet, thus the UCT value
+  // of the action should be set to the initial UCT value.
+  if (m_visits[i] < 0.99f || maxValue == minValue) {
+    return config::ComputeOptions::initial_uct;
+  }
+  return math::UCTFromLog(math::normalize(m_values[i], maxValue, minValue), m_visits[i],
+                          logTotalVisits, cp);
+}
+
+/**
+ * @brief Returns the index of the action with the maximum UCT value, the first one in case of
+ * ties. The UCT values are evaluated on the fly and not stored.
+ *
+ * @param cp The exploration constant.
+ * @return std::size_t The index of the action, 0 if there are no actions.
+ */
+std::size_t ActionStatistics::argmaxUCT(const float cp) const {
+  if (m_uctValid && m_uctCp == cp) return math::argmax(m_uct);
+
+  const float logTotalVisits{std::log(m_totalVisits)};
+  std::size_t best{0};
+  float bestUCT{std::numeric_limits<float>::lowest()};
+  for (std::size_t i = 0; i < size(); ++i) {
+    const float uct{uctScore(i, cp, logTotalVisits)};
+    if (uct > bestUCT) {
+      bestUCT = uct;
+      best    = i;
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief Returns the UCT value of each action, evaluated if the statistics have changed since the
+ * last evaluation.
+ *
+ * @param cp The exploration constant.
+ * @return const std::vector<float>& The UCT value of each action.
+ */
+const std::vector<float>& ActionStatistics::uctScores(const float cp) const {
+  if (!m_uctValid || m_uctCp != cp) {
+    const float logTotalVisits{std::log(m_totalVisits)};
+    for (std::size_t i = 0; i < size(); ++i) {
+      m_uct[i] = uctScore(i, cp, logTotalVisits);
+    }
+    m_uctValid = true;
+    m_uctCp    = cp;
+  }
+  return m_uct;
+}
+
+/**
+ * @brief Updates the bounds of the action values after the value of an action has changed. If the
+ * former minimum or maximum has moved inwards, the bounds are recomputed on the next access.
+ *
+ * @param oldValue The former value of the action.
+ * @param newValue The new value of the action.
+ */
+void ActionStatistics::updateValueBounds(const float oldValue, const float newValue) {
+  if (!m_valueBoundsValid) return;
+  if (newValue > m_maxValue) {
+    m_maxValue = newValue;
+  } else if (oldValue == m_maxValue && newValue < oldValue) {
+    m_valueBoundsValid = false;
+  }
+  if (newValue < m_minValue) {
+    m_minValue = newValue;
+  } else if (oldValue == m_minValue && newValue > oldValue) {
+    m_valueBoundsValid = false;
+  }
+}
+
+/**
+ * @brief Updates the average action value of an action class from the sum of the visit weighted
+ * values of its actions.
+ *
+ * @param classId The index of the action class.
+ */
+void ActionStatistics::updateClassValue(const std::size_t classId) {
+  // only evaluate the action class if the information within the group is high enough, avoids
+  // division by zero
+  m_classValues[classId] =
+      m_classVisits[classId] > 0.1f ? m_classValueSums[classId] / m_classVisits[classId] : 0.0f;
+}
+
+/**
+ * @brief Exports the statistics to JSON, using the keys and layout of the former action maps of
+ * the agent.
+ *
+ * @return json The statistics.
+ */
+json ActionStatistics::toJSON() const {
+  json j;
+  j["m_actionVisits"]      = pairsToJSON(m_actions, m_visits);
+  j["m_actionValues"]      = pairsToJSON(m_actions, m_values);
+  j["m_actionUCT"]         = pairsToJSON(m_actions, uctScores(cOpt().uct_cp));
+  j["m_actionClassVisits"] = pairsToJSON(m_classes, m_classVisits);
+  j["m_actionClassValues"] = pairsToJSON(m_classes, m_classValues);
+  j["m_actionClassUCT"]    = pairsToJSON(m_classes, m_classUCT);
+  j["m_actionClassCount"]  = pairsToJSON(m_classes, m_classCount);
+  return j;
+}
+}  // namespace proseco_planning
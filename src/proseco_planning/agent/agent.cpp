@@ -50,15 +50,43 @@ Agent::Agent(const config::Agent& agent)
  * @brief Clears all action maps (i.e. action and action class maps).
  */
 void Agent::clearActionMaps() {
-  // reset action maps
-  m_actionVisits.clear();
-  m_actionValues.clear();
-  m_actionUCT.clear();
-  // reset action class maps
-  m_actionClassUCT.clear();
-  m_actionClassValues.clear();
-  m_actionClassVisits.clear();
-  m_actionClassCount.clear();
+  // reset action and action class statistics
+  m_actionStatistics.clear();
+}
+
+/**
+ * @brief Sets the available actions for the current vehicle state and takes over the statistics of
+ * the actions of another agent, e.g. the corresponding agent of a reused search tree.
+ * @details The actions provided by the action space depend on the vehicle state (e.g. the lateral
+ * change to the lane centers), hence they are created anew and take over the statistics of the
+ * action with the same id. Actions added by progressive widening are kept as they are. The ids of
+ * the actions are preserved, since the actions are added in the same order: the actions of the
+ * action space come first and progressive widening is only applied below the depth at which the
+ * action space provides all of its actions.
+ *
+ * @param agent The agent to take over the action statistics from.
+ * @param depth Depth of the node.
+ */
+void Agent::reuseActions(const Agent& agent, unsigned int depth) {
+  setAvailableActions(depth);
+  const auto& statistics = agent.m_actionStatistics;
+
+  for (size_t i = m_actionStatistics.size(); i < statistics.size(); ++i) {
+    addAvailableAction(statistics.m_actions[i]);
+  }
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    m_actionStatistics.m_visits[i] = statistics.m_visits[i];
+    m_actionStatistics.m_values[i] = statistics.m_values[i];
+  }
+  // the totals and the class statistics are derived from the copied statistics
+  m_actionStatistics.invalidate();
+  for (size_t source = 0; source < statistics.nClasses(); ++source) {
+    const auto target{m_actionStatistics.findClass(statistics.m_classes[source])};
+    if (target != ActionStatistics::npos) {
+      m_actionStatistics.m_classUCT[target] = statistics.m_classUCT[source];
+    }
+  }
+  m_actionValue = agent.m_actionValue;
 }
 
 /**
@@ -126,21 +154,8 @@ void Agent::addActionsToMaps(const ActionSet& actions) {
  * @param action The action to add.
  */
 void Agent::addActionToMaps(const ActionPtr& action) {
-  // add the new action to the maps using default values
-  m_actionVisits.insert(std::make_pair(action, 0.0f));
-  m_actionValues.insert(std::make_pair(action, 0.0f));
-  m_actionUCT.insert(std::make_pair(action, config::ComputeOptions::initial_uct));
-
-  m_actionClassVisits.insert(std::make_pair(action->m_actionClass, 0.0f));
-  m_actionClassValues.insert(std::make_pair(action->m_actionClass, 0.0f));
-  m_actionClassUCT.insert(
-      std::make_pair(action->m_actionClass, config::ComputeOptions::initial_uct));
-  auto [_, inserted] = m_actionClassCount.insert(std::make_pair(action->m_actionClass, 1));
-  if (!inserted) {
-    // !inserted, because the action class already exists in the map, therefore, increment the
-    // action class count by one.
-    ++m_actionClassCount.at(action->m_actionClass);
-  }
+  // add the new action using default values, this increments the action class count by one
+  m_actionStatistics.add(action);
 }
 
 /**
@@ -174,6 +189,21 @@ void Agent::setAction(ActionPtr action, const TrajectoryGenerator& trajectoryGen
   m_actionCost = m_costModel->calculateActionCost(m_trajectory);
 }
 
+/**
+ * @brief Sets an action of the agents action space, whose trajectory and cost have already been
+ * calculated from the same state of the agent.
+ * @param trajectory The trajectory of the action.
+ * @param actionCost The cost of the action.
+ */
+void Agent::setAction(const Trajectory& trajectory, const float actionCost) {
+  m_stateReward   = 0.0f;
+  m_egoReward     = 0.0f;
+  m_coopReward    = 0.0f;
+  m_safeRangeCost = 0.0f;
+  m_trajectory    = trajectory;
+  m_actionCost    = actionCost;
+}
+
 void Agent::calculateCosts(const Vehicle& vehiclePreviousStep, const float beforePotential) {
   if ("costExponential" == m_costModel->m_type) {
     m_stateReward = m_costModel->updateStatePotential(m_desire, m_vehicle);
@@ -256,9 +286,8 @@ bool Agent::desiresFulfilled() const { return m_desire.desiresFulfilled(m_vehicl
  * @return float Total action visits over all actions.
  */
 float Agent::cumulativeActionVisits() const {
-  return std::accumulate(
-      m_actionVisits.begin(), m_actionVisits.end(), 0.0f,
-      [](float sum, const std::pair<ActionPtr, float>& action) { return (sum + action.second); });
+  return std::accumulate(m_actionStatistics.m_visits.begin(), m_actionStatistics.m_visits.end(),
+                         0.0f);
 }
 
 /**
@@ -267,10 +296,8 @@ float Agent::cumulativeActionVisits() const {
  * @return float Total action visits over all action classes.
  */
 float Agent::cumulativeActionClassVisits() const {
-  return std::accumulate(m_actionClassVisits.begin(), m_actionClassVisits.end(), 0.0f,
-                         [](float sum, const std::pair<ActionClass, float>& actionClass) {
-                           return (sum + actionClass.second);
-                         });
+  return std::accumulate(m_actionStatistics.m_classVisits.begin(),
+                         m_actionStatistics.m_classVisits.end(), 0.0f);
 }
 
 /**
@@ -278,7 +305,9 @@ float Agent::cumulativeActionClassVisits() const {
  *
  * @return ActionPtr The action with maximum visit count.
  */
-ActionPtr Agent::maxActionVisitsAction() const { return math::max_map_element(m_actionVisits); }
+ActionPtr Agent::maxActionVisitsAction() const {
+  return m_actionStatistics.m_actions[math::argmax(m_actionStatistics.m_visits)];
+}
 
 /**
  * @brief Returns the action class with the maximum visit count of any action class.
@@ -286,7 +315,7 @@ ActionPtr Agent::maxActionVisitsAction() const { return math::max_map_element(m_
  * @return ActionClass The action class with maximum visit count.
  */
 ActionClass Agent::maxActionVisitsActionClass() const {
-  return math::max_map_element(m_actionClassVisits);
+  return m_actionStatistics.m_classes[math::argmax(m_actionStatistics.m_classVisits)];
 }
 
 /**
@@ -294,35 +323,47 @@ ActionClass Agent::maxActionVisitsActionClass() const {
  *
  * @return float Maximum action value.
  */
-float Agent::maxActionValue() const { return math::max_map_value(m_actionValues); }
+float Agent::maxActionValue() const {
+  return *std::max_element(m_actionStatistics.m_values.begin(), m_actionStatistics.m_values.end());
+}
 
 /**
  * @brief Returns the minimum action value of any action.
  *
  * @return float Minimum action value.
  */
-float Agent::minActionValue() const { return math::min_map_value(m_actionValues); }
+float Agent::minActionValue() const {
+  return *std::min_element(m_actionStatistics.m_values.begin(), m_actionStatistics.m_values.end());
+}
 
 /**
  * @brief Returns the action with the maximum action value of any action.
  *
  * @return ActionPtr Maximum action value action.
  */
-ActionPtr Agent::maxActionValueAction() const { return math::max_map_element(m_actionValues); }
+ActionPtr Agent::maxActionValueAction() const {
+  return m_actionStatistics.m_actions[math::argmax(m_actionStatistics.m_values)];
+}
 
 /**
  * @brief Returns the maximum action value of any action class.
  *
  * @return float Maximum action value.
  */
-float Agent::maxActionClassActionValue() const { return math::max_map_value(m_actionClassValues); }
+float Agent::maxActionClassActionValue() const {
+  return *std::max_element(m_actionStatistics.m_classValues.begin(),
+                           m_actionStatistics.m_classValues.end());
+}
 
 /**
  * @brief Returns the minimum action value of any action class.
  *
  * @return float Minimum action value.
  */
-float Agent::minActionClassActionValue() const { return math::min_map_value(m_actionClassValues); }
+float Agent::minActionClassActionValue() const {
+  return *std::min_element(m_actionStatistics.m_classValues.begin(),
+                           m_actionStatistics.m_classValues.end());
+}
 
 /**
  * @brief Returns the action class with the maximum action value of any action class.
@@ -330,7 +371,7 @@ float Agent::minActionClassActionValue() const { return math::min_map_value(m_ac
  * @return ActionClass Maximum action value action class.
  */
 ActionClass Agent::maxActionValueActionClass() const {
-  return math::max_map_element(m_actionClassValues);
+  return m_actionStatistics.m_classes[math::argmax(m_actionStatistics.m_classValues)];
 }
 
 /**
@@ -338,21 +379,29 @@ ActionClass Agent::maxActionValueActionClass() const {
  *
  * @return float Maximum UCT value.
  */
-float Agent::maxActionUCT() const { return math::max_map_value(m_actionUCT); }
+float Agent::maxActionUCT() const {
+  const auto& uctValues = m_actionStatistics.uctScores(cOpt().uct_cp);
+  return *std::max_element(uctValues.begin(), uctValues.end());
+}
 
 /**
  * @brief Returns the minimum UCT value of any action.
  *
  * @return float Minimum UCT value.
  */
-float Agent::minActionUCT() const { return math::min_map_value(m_actionUCT); }
+float Agent::minActionUCT() const {
+  const auto& uctValues = m_actionStatistics.uctScores(cOpt().uct_cp);
+  return *std::min_element(uctValues.begin(), uctValues.end());
+}
 
 /**
  * @brief Returns the action with the maximum UCT value of any action.
  *
  * @return ActionPtr Maximum UCT value action.
  */
-ActionPtr Agent::maxActionUCTAction() const { return math::max_map_element(m_actionUCT); }
+ActionPtr Agent::maxActionUCTAction() const {
+  return m_actionStatistics.m_actions[m_actionStatistics.argmaxUCT(cOpt().uct_cp)];
+}
 
 /**
  * @brief Returns the action class with the maximum UCT value of any action class.
@@ -360,9 +409,9 @@ ActionPtr Agent::maxActionUCTAction() const { return math::max_map_element(m_act
  * @return ActionClass Maximum UCT value action class.
  */
 ActionClass Agent::maxActionUCTActionClass() const {
-  assert(m_actionClassUCT.count(ActionClass::NONE) == 0 &&
+  assert(m_actionStatistics.findClass(ActionClass::NONE) == ActionStatistics::npos &&
          "Action classes must be initialized before usage.");
-  return math::max_map_element(m_actionClassUCT);
+  return m_actionStatistics.m_classes[math::argmax(m_actionStatistics.m_classUCT)];
 }
 
 /**
@@ -398,13 +447,7 @@ void to_json(json& j, const Agent& agent) {
   j["m_searchGuide"]       = cOpt().policy_options.policy_enhancements.search_guide.toJSON();
   j["m_costModel"]         = sOpt().agents[agent.m_id].cost_model.toJSON();
   j["vehicle"]             = agent.m_vehicle;
-  j["m_actionVisits"]      = agent.m_actionVisits;
-  j["m_actionValues"]      = agent.m_actionValues;
-  j["m_actionUCT"]         = agent.m_actionUCT;
-  j["m_actionClassVisits"] = agent.m_actionClassVisits;
-  j["m_actionClassValues"] = agent.m_actionClassValues;
-  j["m_actionClassUCT"]    = agent.m_actionClassUCT;
-  j["m_actionClassCount"]  = agent.m_actionClassCount;
+  j.update(agent.m_actionStatistics.toJSON());
   j["m_desire"]            = agent.m_desire;
   j["m_cooperationFactor"] = agent.m_cooperationFactor;
   j["m_egoReward"]         = agent.m_egoReward;
@@ -105,7 +105,7 @@ int Vehicle::getLane(const float position_Y) {
  *
  * @param finalState
  */
-void Vehicle::updateState(const std::vector<float>& finalState) {
+void Vehicle::updateState(const std::array<float, 8>& finalState) {
   m_positionX     = finalState[0];
   m_positionY     = finalState[1];
   m_velocityX     = finalState[2];
@@ -0,0 +1,149 @@
+#include "proseco_planning/childIndex.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include "proseco_planning/action/action.h"
+#include "proseco_planning/node.h"
+#include "proseco_planning/util/json.h"
+
+namespace proseco_planning {
+
+/**
+ * @brief Calculates the hash of the action ids of an action set.
+ *
+ * @param actionIds The action ids.
+ * @return std::size_t The hash.
+ */
+std::size_t ChildIndex::hash(const ActionIdSet& actionIds) {
+  std::uint64_t seed{actionIds.size()};
+  for (const auto actionId : actionIds) {
+    seed ^= actionId + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2);
+  }
+  // finalize (splitmix64), the ids are small integers
+  seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9;
+  seed = (seed ^ (seed >> 27)) * 0x94d049bb133111eb;
+  return static_cast<std::size_t>(seed ^ (seed >> 31));
+}
+
+/**
+ * @brief Adds a child to the index, unless a child for the action ids already exists.
+ *
+ * @param actionIds The action ids of the action set that leads to the child.
+ * @param child The pointer to the child node.
+ * @return true If the child has been added.
+ * @return false If a child for the action ids already exists.
+ */
+bool ChildIndex::insert(const ActionIdSet& actionIds, Node* const child) {
+  if (m_children.empty()) {
+    m_nAgents = actionIds.size();
+  } else if (actionIds.size() != m_nAgents) {
+    throw std::invalid_argument("ChildIndex::insert: the number of action ids does not match");
+  }
+  const auto actionIdsHash = hash(actionIds);
+  if (findEntry(actionIds, actionIdsHash) != m_children.size()) return false;
+
+  // keep the load factor at or below 0.5
+  if (2 * (m_children.size() + 1) > m_slots.size()) {
+    rehash(m_slots.empty() ? 8 : 2 * m_slots.size());
+  }
+  m_actionIds.insert(m_actionIds.end(), actionIds.begin(), actionIds.end());
+  m_children.push_back(child);
+  m_hashes.push_back(actionIdsHash);
+
+  const std::size_t mask{m_slots.size() - 1};
+  auto slot = actionIdsHash & mask;
+  while (m_slots[slot] != emptySlot) slot = (slot + 1) & mask;
+  m_slots[slot] = static_cast<std::uint32_t>(m_children.size());
+  return true;
+}
+
+/**
+ * @brief Returns the child that is reached by the action ids.
+ *
+ * @param actionIds The action ids.
+ * @return Node* The pointer to the child node, nullptr if the child does not exist.
+ */
+Node* ChildIndex::find(const ActionIdSet& actionIds) const {
+  const auto index = findEntry(actionIds, hash(actionIds));
+  return index != m_children.size() ? m_children[index] : nullptr;
+}
+
+/**
+ * @brief Returns the child that is reached by the action ids.
+ *
+ * @param actionIds The action ids.
+ * @return Node* The pointer to the child node.
+ * @throws std::out_of_range If the child does not exist.
+ */
+Node* ChildIndex::at(const ActionIdSet& actionIds) const {
+  auto child = find(actionIds);
+  if (child == nullptr) {
+    throw std::out_of_range("ChildIndex::at: no child for the action set");
+  }
+  return child;
+}
+
+/**
+ * @brief Removes all children from the index.
+ *
+ */
+void ChildIndex::clear() {
+  m_nAgents = 0;
+  m_actionIds.clear();
+  m_children.clear();
+  m_hashes.clear();
+  m_slots.clear();
+}
+
+/**
+ * @brief Returns the index of the entry of the action ids.
+ *
+ * @param actionIds The action ids.
+ * @param hash The hash of the action ids.
+ * @return std::size_t The index of the entry, the number of entries if it does not exist.
+ */
+std::size_t ChildIndex::findEntry(const ActionIdSet& actionIds, const std::size_t hash) const {
+  if (m_slots.empty() || actionIds.size() != m_nAgents) return m_children.size();
+
+  const std::size_t mask{m_slots.size() - 1};
+  for (auto slot = hash & mask; m_slots[slot] != emptySlot; slot = (slot + 1) & mask) {
+    const std::size_t index{m_slots[slot] - 1u};
+    if (m_hashes[index] == hash &&
+        std::equal(actionIds.begin(), actionIds.end(), m_actionIds.begin() + index * m_nAgents)) {
+      return index;
+    }
+  }
+  return m_children.size();
+}
+
+/**
+ * @brief Rebuilds the open addressing table with the given number of slots.
+ *
+ * @param nSlots The number of slots, must be a power of two.
+ */
+void ChildIndex::rehash(const std::size_t nSlots) {
+  m_slots.assign(nSlots, emptySlot);
+  const std::size_t mask{nSlots - 1};
+  for (std::size_t index = 0; index < m_hashes.size(); ++index) {
+    auto slot = m_hashes[index] & mask;
+    while (m_slots[slot] != emptySlot) slot = (slot + 1) & mask;
+    m_slots[slot] = static_cast<std::uint32_t>(index + 1);
+  }
+}
+
+/**
+ * @brief Function to allow conversion of a ChildIndex to a JSON object.
+ * @details Gets called by the json constructor of the nlohmann json library.
+ *
+ * @param j The JSON object to be filled.
+ * @param childIndex The ChildIndex to be converted.
+ */
+void to_json(json& j, const ChildIndex& childIndex) {
+  j = json::array();
+  for (const auto child : childIndex) {
+    j.push_back(json::array({child->actionSet(), child}));
+  }
+}
+}  // namespace proseco_planning
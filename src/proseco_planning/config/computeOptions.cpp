@@ -137,6 +137,62 @@ ProgressiveWidening ProgressiveWidening::fromJSON(const json& jProgressiveWideni
   return progressiveWidening;
 }
 
+/**
+ * @brief Exports the parameters of the TreeReuse object to JSON.
+ *
+ * @return json The parameters.
+ */
+json TreeReuse::toJSON() const {
+  json jTreeReuse;
+  jTreeReuse["active"]                 = active;
+  jTreeReuse["max_position_drift"]     = max_position_drift;
+  jTreeReuse["max_velocity_drift"]     = max_velocity_drift;
+  jTreeReuse["max_acceleration_drift"] = max_acceleration_drift;
+  jTreeReuse["max_heading_drift"]      = max_heading_drift;
+  return jTreeReuse;
+}
+
+/**
+ * @brief Returns a new TreeReuse object created from the parameters of the JSON file.
+ *
+ * @param jTreeReuse The JSON file.
+ * @return TreeReuse
+ */
+TreeReuse TreeReuse::fromJSON(const json& jTreeReuse) {
+  TreeReuse treeReuse = TreeReuse(jTreeReuse["active"].get<bool>(),
+                                  jTreeReuse["max_position_drift"].get<float>(),
+                                  jTreeReuse["max_velocity_drift"].get<float>(),
+                                  jTreeReuse["max_acceleration_drift"].get<float>(),
+                                  jTreeReuse["max_heading_drift"].get<float>());
+  return treeReuse;
+}
+
+/**
+ * @brief Exports the parameters of the EarlyStopping object to JSON.
+ *
+ * @return json The parameters.
+ */
+json EarlyStopping::toJSON() const {
+  json jEarlyStopping;
+  jEarlyStopping["active"]          = active;
+  jEarlyStopping["check_interval"]  = check_interval;
+  jEarlyStopping["budget_fraction"] = budget_fraction;
+  return jEarlyStopping;
+}
+
+/**
+ * @brief Returns a new EarlyStopping object created from the parameters of the JSON file.
+ *
+ * @param jEarlyStopping The JSON file.
+ * @return EarlyStopping
+ */
+EarlyStopping EarlyStopping::fromJSON(const json& jEarlyStopping) {
+  EarlyStopping earlyStopping = EarlyStopping(jEarlyStopping["active"].get<bool>(),
+                                              jEarlyStopping["check_interval"].get<unsigned int>(),
+                                              jEarlyStopping["budget_fraction"].get<float>());
+  return earlyStopping;
+}
+
 /**
  * @brief Exports the parameters of the PolicyEnhancement object to JSON.
  *
@@ -150,6 +206,8 @@ json PolicyEnhancements::toJSON() const {
   jPolicyEnhancements["progressive_widening"]      = progressive_widening.toJSON();
   jPolicyEnhancements["action_execution_fraction"] = action_execution_fraction;
   jPolicyEnhancements["q_scale"]                   = q_scale;
+  jPolicyEnhancements["tree_reuse"]                = tree_reuse.toJSON();
+  jPolicyEnhancements["early_stopping"]            = early_stopping.toJSON();
   return jPolicyEnhancements;
 }
 
@@ -166,7 +224,15 @@ PolicyEnhancements PolicyEnhancements::fromJSON(const json& jPolicyEnhancements)
                          MoveGrouping::fromJSON(jPolicyEnhancements["move_grouping"]),
                          ProgressiveWidening::fromJSON(jPolicyEnhancements["progressive_widening"]),
                          jPolicyEnhancements["action_execution_fraction"].get<float>(),
-                         jPolicyEnhancements["q_scale"].get<float>());
+                         jPolicyEnhancements["q_scale"].get<float>(),
+                         // tree reuse is optional to keep existing configurations valid
+                         jPolicyEnhancements.contains("tree_reuse")
+                             ? TreeReuse::fromJSON(jPolicyEnhancements["tree_reuse"])
+                             : TreeReuse(false, 0.0f, 0.0f, 0.0f, 0.0f),
+                         // early stopping is optional to keep existing configurations valid
+                         jPolicyEnhancements.contains("early_stopping")
+                             ? EarlyStopping::fromJSON(jPolicyEnhancements["early_stopping"])
+                             : EarlyStopping(false, 100, 1.0f));
   return policyEnhancements;
 }
 
@@ -256,6 +322,9 @@ json ParallelizationOptions::toJSON() const {
   jParallelizationOptions["similarity_voting"]      = similarity_voting;
   jParallelizationOptions["similarity_gamma"]       = similarity_gamma;
   jParallelizationOptions["simulation_aggregation"] = simulation_aggregation;
+  jParallelizationOptions["mode"]                   = mode;
+  jParallelizationOptions["virtual_loss"]           = virtual_loss;
+  jParallelizationOptions["thread_pinning"]         = thread_pinning;
   return jParallelizationOptions;
 }
 
@@ -270,7 +339,18 @@ ParallelizationOptions ParallelizationOptions::fromJSON(const json& jParalleliza
           jParallelizationOptions["n_simulationThreads"].get<unsigned int>(),
           jParallelizationOptions["similarity_voting"].get<bool>(),
           jParallelizationOptions["similarity_gamma"].get<float>(),
-          jParallelizationOptions["simulation_aggregation"].get<std::string>()};
+          jParallelizationOptions["simulation_aggregation"].get<std::string>(),
+          // the mode, the virtual loss and the thread pinning are optional to keep existing
+          // configurations valid
+          jParallelizationOptions.contains("mode")
+              ? jParallelizationOptions["mode"].get<std::string>()
+              : "root",
+          jParallelizationOptions.contains("virtual_loss")
+              ? jParallelizationOptions["virtual_loss"].get<float>()
+              : 1.0f,
+          jParallelizationOptions.contains("thread_pinning")
+              ? jParallelizationOptions["thread_pinning"].get<bool>()
+              : false};
 }
 
 /**
@@ -353,6 +433,7 @@ json ComputeOptions::toJSON() const {
   jComputeOptions["noise"]                      = noise.toJSON();
   jComputeOptions["action_noise"]               = action_noise.toJSON();
   jComputeOptions["region_of_interest"]         = region_of_interest;
+  jComputeOptions["huge_pages"]                 = huge_pages;
   return jComputeOptions;
 }
 
@@ -386,7 +467,8 @@ ComputeOptions ComputeOptions::fromJSON(const json& jComputeOptions) {
       jComputeOptions["trajectory_type"].get<std::string>(), jComputeOptions["uct_cp"].get<float>(),
       Noise::fromJSON(jComputeOptions["noise"]),
       ActionNoise::fromJSON(jComputeOptions["action_noise"]),
-      jComputeOptions["region_of_interest"].get<float>());
+      jComputeOptions["region_of_interest"].get<float>(),
+      jComputeOptions.contains("huge_pages") ? jComputeOptions["huge_pages"].get<bool>() : false);
   return computeOptions;
 }
 }  // namespace proseco_planning::config
\ No newline at end of file
@@ -44,17 +44,20 @@ config::MoveGroupingCriteriaPW moveGroupingCriteriaPW = MoveGroupingCriteriaPW(f
 config::MoveGrouping moveGrouping =
     MoveGrouping(false, 12.0f, moveGroupingCriteriaPW, false, false);
 config::ProgressiveWidening progressiveWidening = ProgressiveWidening(2, 0.5, 25);
+config::TreeReuse treeReuse                     = TreeReuse(false, 0.5, 0.5, 0.5, 0.05);
+config::EarlyStopping earlyStopping             = EarlyStopping(false, 100, 1.0f);
 config::PolicyEnhancements policyEnhancements =
-    PolicyEnhancements(simUpdate, searchGuide, moveGrouping, progressiveWidening, 1.0, 100.0);
+    PolicyEnhancements(simUpdate, searchGuide, moveGrouping, progressiveWidening, 1.0, 100.0,
+                       treeReuse, earlyStopping);
 config::PolicyOptions policyOptions = PolicyOptions("UCTProgressiveWidening", "UCT", "moderate",
                                                     "UCT", "maxActionValue", policyEnhancements);
 config::ParallelizationOptions parallelizationOptions =
-    ParallelizationOptions(1, 1, true, 1.0f, "max");
+    ParallelizationOptions(1, 1, true, 1.0f, "max", "root", 1.0f, false);
 config::Noise noise = Noise(false, 0, 0.15);
 config::ComputeOptions cOptions =
     ComputeOptions(0, 100, 15.0f, 13, 12.0f, 5, 10, 0.7f, 0.1f, 2.0f, "circleApproximation", 0,
                    "scenario", policyOptions, parallelizationOptions, "jerkOptimal", 4.0f, noise,
-                   ActionNoise(false, 0, 0, 0, 0), false);
+                   ActionNoise(false, 0, 0, 0, 0), false, false);
 
 Options optionsSimple = Options(oOptions, cOptions);
 
@@ -4,6 +4,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <utility>
 
 #include "nlohmann/json.hpp"
 #include "proseco_planning/action/action.h"
@@ -131,14 +132,15 @@ void JSONExporter::exportIrlTrajectory(const Node* const node, const ActionSet&
     json actionDic;
     actionDic["deltaY"]              = action->m_lateralChange;
     actionDic["deltaVx"]             = action->m_velocityChange;
-    actionDic["likelihoodY"]         = action->noise.m_likelihoodY;
-    actionDic["likelihoodVx"]        = action->noise.m_likelihoodVx;
-    actionDic["muY"]                 = action->noise.m_muY;
-    actionDic["muVx"]                = action->noise.m_muVx;
-    actionDic["sigmaY"]              = action->noise.m_sigmaY;
-    actionDic["sigmaVx"]             = action->noise.m_sigmaVx;
-    actionDic["selectionLikelihood"] = action->m_selectionLikelihood;
-    actionDic["selectionWeights"]    = action->m_selectionWeights;
+    const auto& annotation           = std::as_const(*action).annotation();
+    actionDic["likelihoodY"]         = annotation.noise.m_likelihoodY;
+    actionDic["likelihoodVx"]        = annotation.noise.m_likelihoodVx;
+    actionDic["muY"]                 = annotation.noise.m_muY;
+    actionDic["muVx"]                = annotation.noise.m_muVx;
+    actionDic["sigmaY"]              = annotation.noise.m_sigmaY;
+    actionDic["sigmaVx"]             = annotation.noise.m_sigmaVx;
+    actionDic["selectionLikelihood"] = annotation.m_selectionLikelihood;
+    actionDic["selectionWeights"]    = annotation.m_selectionWeights;
     trajectoryDic["action"]          = actionDic;
 
     json featuresDic;
@@ -1,18 +1,24 @@
 #include "proseco_planning/monteCarloTreeSearch.h"
 
 #include <sys/types.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <climits>
 #include <cstddef>
 #include <fstream>
 #include <future>
 #include <map>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "proseco_planning/action/action.h"
 #include "proseco_planning/agent/agent.h"
 #include "proseco_planning/agent/vehicle.h"
+#include "proseco_planning/collision_checker/collisionChecker.h"
 #include "proseco_planning/config/computeOptions.h"
 #include "proseco_planning/config/configuration.h"
 #include "proseco_planning/config/outputOptions.h"
@@ -23,6 +29,9 @@
 #include "proseco_planning/policies/selectionPolicy.h"
 #include "proseco_planning/policies/simulationPolicy.h"
 #include "proseco_planning/policies/updatePolicy.h"
+#include "proseco_planning/searchContext.h"
+#include "proseco_planning/trajectory/trajectorygenerator.h"
+#include "proseco_planning/util/threadPool.h"
 
 namespace proseco_planning {
 
@@ -30,23 +39,79 @@ namespace proseco_planning {
 //### BUILD THE SEARCH TREE
 //#########################################################
 
+/**
+ * @brief Checks whether the search has converged: the best action of every agent at the root, in
+ * terms of visits, is unchanged since the last check and its lead over the runner-up exceeds the
+ * given fraction of the remaining iterations, i.e. the remaining budget can (almost) not overturn
+ * the final selection anymore.
+ *
+ * @param root The root node.
+ * @param bestActions The index of the best action of each agent at the last check, updated.
+ * @param remainingIterations The number of remaining iterations.
+ * @param virtualVisits The virtual visits of the actions of each agent that belong to iterations in
+ * progress (tree parallelization), they are not counted.
+ * @return true If the search has converged.
+ */
+bool isConverged(const Node* const root, std::vector<std::size_t>& bestActions,
+                 const unsigned int remainingIterations,
+                 const std::vector<std::vector<float>>& virtualVisits) {
+  const auto& earlyStopping = cOpt().policy_options.policy_enhancements.early_stopping;
+  const float requiredLead{earlyStopping.budget_fraction * static_cast<float>(remainingIterations)};
+
+  bool converged{bestActions.size() == root->m_agents.size()};
+  bestActions.resize(root->m_agents.size(), ActionStatistics::npos);
+  for (size_t i = 0; i < root->m_agents.size(); ++i) {
+    auto visits = root->m_agents[i].m_actionStatistics.m_visits;
+    if (visits.empty()) {
+      bestActions[i] = ActionStatistics::npos;
+      converged      = false;
+      continue;
+    }
+    if (i < virtualVisits.size()) {
+      for (size_t a = 0; a < std::min(visits.size(), virtualVisits[i].size()); ++a) {
+        visits[a] -= virtualVisits[i][a];
+      }
+    }
+    const auto best{math::argmax(visits)};
+    float runnerUp{0.0f};
+    for (size_t a = 0; a < visits.size(); ++a) {
+      if (a != best) runnerUp = std::max(runnerUp, visits[a]);
+    }
+    converged      = converged && best == bestActions[i] && visits[best] - runnerUp > requiredLead;
+    bestActions[i] = best;
+  }
+  return converged;
+}
+
 /**
  * @brief Builds the search tree according to the MCTS approach.
  *
  * @param root Pointer to the root node.
+ * @param threadPool The thread pool that runs the parallel simulations.
  * @return std::unique_ptr<Node> Pointer to the root node of the final search tree.
  */
-std::unique_ptr<Node> computeTree(std::unique_ptr<Node> root) {
+std::unique_ptr<Node> computeTree(std::unique_ptr<Node> root, util::ThreadPool& threadPool) {
   //### create policies according to compute optinos
   auto selectionPolicy  = SelectionPolicy::createPolicy(cOpt().policy_options.selection_policy);
   auto simulationPolicy = SimulationPolicy::createPolicy(cOpt().policy_options.simulation_Policy,
-                                                         root->m_agents.size());
+                                                         root->m_agents.size(), threadPool);
   auto expansionPolicy  = ExpansionPolicy::createPolicy(cOpt().policy_options.expansion_policy);
   auto updatePolicy     = UpdatePolicy::createPolicy(cOpt().policy_options.update_policy);
 
-  // initialize the available actions of the rootNode
-  for (auto& agent : root->m_agents) {
-    agent.setAvailableActions(root->m_depth);
+  // the search tree is allocated from a node arena owned by the root node, every iteration expands
+  // at most one node; the whole tree is released at once when the root node is destroyed
+  root->reserveNodes(cOpt().n_iterations, cOpt().huge_pages);
+
+  // initialize the available actions of the rootNode, unless the root continues a reused tree;
+  // the root is expanded most often, hence all available actions are executed upfront in batches
+  if (!root->hasChildren()) {
+    for (auto& agent : root->m_agents) {
+      agent.setAvailableActions(root->m_depth);
+    }
+    auto collisionChecker = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
+    auto trajectoryGenerator =
+        TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+    root->memoizeAvailableActions(*collisionChecker, *trajectoryGenerator);
   }
 
   // maximum duration of one planning step
@@ -58,8 +123,18 @@ std::unique_ptr<Node> computeTree(std::unique_ptr<Node> root) {
   // measure the elapsed time for this planning step
   unsigned int elapsedTime{0};
 
+  const auto& earlyStopping = cOpt().policy_options.policy_enhancements.early_stopping;
+  const unsigned int checkInterval{std::max(earlyStopping.check_interval, 1u)};
+  std::vector<std::size_t> bestActions;
+
   for (unsigned int iteration = 0;
        (iteration < cOpt().n_iterations && elapsedTime < maxStepDuration); ++iteration) {
+    // stop early once the best actions at the root can no longer be overturned
+    if (earlyStopping.active && iteration > 0 && iteration % checkInterval == 0 &&
+        isConverged(root.get(), bestActions, cOpt().n_iterations - iteration)) {
+      break;
+    }
+
     // Start timer to measure the duration of this iteration
     auto startTime = std::chrono::steady_clock::now();
 
@@ -132,6 +207,260 @@ std::unique_ptr<Node> computeTree(std::unique_ptr<Node> root) {
   return root;
 }
 
+//#########################################################
+//### BUILD A SHARED SEARCH TREE WITH MULTIPLE THREADS
+//#########################################################
+
+namespace {
+/**
+ * @brief This struct describes the virtual loss of an iteration in progress on the actions that
+ * have been selected at a node.
+ */
+struct VirtualLoss {
+  /// The node whose action statistics carry the virtual loss.
+  Node* node;
+  /// The ids of the selected actions of the agents of the node.
+  ActionIdSet actionIds;
+  /// The action value of the virtual visits of each agent.
+  std::vector<float> values;
+};
+
+/**
+ * @brief Adds virtual visits with the lowest action value of the agent to the selected actions,
+ * so that concurrent iterations are pushed towards other actions.
+ * @note The node of the virtual loss has to be locked.
+ *
+ * @param loss The virtual loss, the action values of the virtual visits are set.
+ * @param virtualLoss The number of virtual visits.
+ */
+void addVirtualLoss(VirtualLoss& loss, const float virtualLoss) {
+  auto& agents = loss.node->m_agents;
+  loss.values.resize(agents.size());
+  for (size_t i = 0; i < agents.size(); ++i) {
+    auto& statistics = agents[i].m_actionStatistics;
+    const auto idx   = loss.actionIds[i];
+    const float visits{statistics.m_visits[idx]};
+    loss.values[i] = statistics.minValue();
+    statistics.setValue(idx, (statistics.m_values[idx] * visits + loss.values[i] * virtualLoss) /
+                                 (visits + virtualLoss));
+    statistics.addVisits(idx, virtualLoss);
+  }
+}
+
+/**
+ * @brief Removes the virtual visits of `addVirtualLoss` from the selected actions. Since the
+ * action values are averages, the virtual visits can be removed exactly, regardless of the
+ * updates that took place in between.
+ * @note The node of the virtual loss has to be locked.
+ *
+ * @param loss The virtual loss.
+ * @param virtualLoss The number of virtual visits.
+ */
+void removeVirtualLoss(const VirtualLoss& loss, const float virtualLoss) {
+  auto& agents = loss.node->m_agents;
+  for (size_t i = 0; i < agents.size(); ++i) {
+    auto& statistics = agents[i].m_actionStatistics;
+    const auto idx   = loss.actionIds[i];
+    const float visits{statistics.m_visits[idx] - virtualLoss};
+    if (visits > 1e-3f) {
+      statistics.setValue(
+          idx, (statistics.m_values[idx] * (visits + virtualLoss) - loss.values[i] * virtualLoss) /
+                   visits);
+      statistics.addVisits(idx, -virtualLoss);
+    } else {
+      statistics.setValue(idx, 0.0f);
+      statistics.addVisits(idx, -statistics.m_visits[idx]);
+    }
+  }
+}
+
+/**
+ * @brief Adds visits to the virtual visits of the selected actions of each agent.
+ *
+ * @param virtualVisits The virtual visits of the actions of each agent.
+ * @param actionIds The ids of the selected actions.
+ * @param visits The number of visits, negative for removal.
+ */
+void addVirtualVisits(std::vector<std::vector<float>>& virtualVisits, const ActionIdSet& actionIds,
+                      const float visits) {
+  virtualVisits.resize(actionIds.size());
+  for (size_t i = 0; i < actionIds.size(); ++i) {
+    if (virtualVisits[i].size() <= actionIds[i]) {
+      virtualVisits[i].resize(actionIds[i] + 1, 0.0f);
+    }
+    virtualVisits[i][actionIds[i]] += visits;
+  }
+}
+}  // namespace
+
+/**
+ * @brief Builds a single search tree with multiple threads (tree parallelization).
+ * @details There is no lock for the whole tree, every node is guarded by its own mutex and at most
+ * two adjacent nodes are locked at a time. A new child is added to the tree right away, but marked
+ * as pending until the expanding thread has executed its actions, so that concurrent iterations
+ * that select the same action set continue with that child instead of creating a duplicate. The
+ * simulations start from copies of the nodes and run without any lock. Until its result is
+ * backpropagated, every iteration adds a virtual loss to the actions along its path, so that
+ * concurrent iterations explore different paths.
+ *
+ * @param root Pointer to the root node.
+ * @param nThreads The number of threads.
+ * @param step The current planning step.
+ * @param threadPool The thread pool that runs the threads and the parallel simulations.
+ * @return std::unique_ptr<Node> Pointer to the root node of the final search tree.
+ */
+std::unique_ptr<Node> computeSharedTree(std::unique_ptr<Node> root, const unsigned int nThreads,
+                                        const int step, util::ThreadPool& threadPool) {
+  root->reserveNodes(cOpt().n_iterations, cOpt().huge_pages);
+
+  // initialize the available actions of the rootNode, unless the root continues a reused tree;
+  // the root is expanded most often, hence all available actions are executed upfront in batches
+  if (!root->hasChildren()) {
+    for (auto& agent : root->m_agents) {
+      agent.setAvailableActions(root->m_depth);
+    }
+    auto collisionChecker = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
+    auto trajectoryGenerator =
+        TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+    root->memoizeAvailableActions(*collisionChecker, *trajectoryGenerator);
+  }
+
+  // the maximum duration of the planning step refers to the wall clock time
+  const auto deadline =
+      cOpt().max_step_duration == 0
+          ? std::chrono::steady_clock::time_point::max()
+          : std::chrono::steady_clock::now() +
+                std::chrono::microseconds(static_cast<long>(cOpt().max_step_duration * 1000000));
+  const auto maxDepth    = cOpt().max_search_depth;
+  const auto virtualLoss = cOpt().parallelization_options.virtual_loss;
+
+  const auto& earlyStopping = cOpt().policy_options.policy_enhancements.early_stopping;
+  const unsigned int checkInterval{std::max(earlyStopping.check_interval, 1u)};
+  // the state of the convergence check is guarded by the lock of the root, the virtual visits of
+  // the root actions are tracked, so that the check only counts completed iterations
+  std::vector<std::size_t> bestActions;
+  std::vector<std::vector<float>> rootVirtualVisits;
+
+  std::atomic<unsigned int> nIterations{0};
+  std::atomic<unsigned int> nCompleted{0};
+  std::atomic<bool> converged{false};
+
+  auto search = [&](const unsigned int t) {
+    math::Random::setSalt((t * 11779) + (step << 13));
+    // the policies hold the state of an iteration, hence each thread creates its own policies
+    auto selectionPolicy  = SelectionPolicy::createPolicy(cOpt().policy_options.selection_policy);
+    auto simulationPolicy = SimulationPolicy::createPolicy(cOpt().policy_options.simulation_Policy,
+                                                           root->m_agents.size(), threadPool);
+    auto updatePolicy     = UpdatePolicy::createPolicy(cOpt().policy_options.update_policy);
+    auto collisionChecker = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
+    auto trajectoryGenerator =
+        TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+
+    std::vector<VirtualLoss> losses;
+    while (!converged && nIterations.fetch_add(1) < cOpt().n_iterations &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::vector<float> stepReward(root->m_agents.size(), 0);
+      std::vector<std::vector<float>> agentsRewards(maxDepth, stepReward);
+      ActionSet actionSet;
+      // the node the simulation starts from
+      Node* leaf{nullptr};
+      bool expanded{false};
+      losses.clear();
+
+      //### PHASE 1 SELECTION
+      auto node = selectionPolicy->selectNodeForExpansion(root.get(), actionSet, agentsRewards);
+
+      {
+        std::lock_guard<std::mutex> lock(node->m_mutex);
+        // Add noise to the position of the agents
+        if (cOpt().noise.active) {
+          for (auto& agent : node->m_agents) {
+            agent.m_vehicle.m_positionX += math::getNoise(cOpt().noise.mean, cOpt().noise.sigma);
+            agent.m_vehicle.m_positionY += math::getNoise(cOpt().noise.mean, cOpt().noise.sigma);
+          }
+        }
+
+        //### PHASE 2 EXPANSION (unless a concurrent iteration has expanded the action set already)
+        leaf = node;
+        if (!Policy::isNodeTerminal(node, maxDepth)) {
+          const auto actionIds = node->addActionSet(actionSet);
+          leaf                 = node->m_childMap.find(actionIds);
+          if (leaf == nullptr) {
+            leaf = node->addChild(actionIds);
+            leaf->m_pending.store(true, std::memory_order_relaxed);
+            expanded = true;
+          }
+        }
+      }
+
+      for (auto pathNode = leaf; pathNode->m_parent != nullptr; pathNode = pathNode->m_parent) {
+        losses.push_back({pathNode->m_parent, pathNode->m_actionIds, {}});
+      }
+      for (auto& loss : losses) {
+        std::lock_guard<std::mutex> lock(loss.node->m_mutex);
+        addVirtualLoss(loss, virtualLoss);
+        if (loss.node == root.get()) {
+          addVirtualVisits(rootVirtualVisits, loss.actionIds, virtualLoss);
+        }
+      }
+
+      // the simulation starts from a copy, since the statistics of the leaf might be updated
+      // concurrently
+      std::unique_ptr<Node> simulationNode;
+      if (expanded) {
+        // the pending child is not entered by other threads, hence it is not locked
+        leaf->executeActions(actionSet, *collisionChecker, *trajectoryGenerator, false);
+        simulationNode = std::make_unique<Node>(leaf);
+        leaf->m_pending.store(false, std::memory_order_release);
+      } else {
+        while (leaf->m_pending.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(leaf->m_mutex);
+        simulationNode = std::make_unique<Node>(leaf);
+      }
+      if (leaf != node) {
+        Policy::extractReward(simulationNode.get(), agentsRewards);
+      }
+
+      //### PHASE 3 SIMULATION
+      const auto simDepth =
+          simulationPolicy->runSimulation(simulationNode.get(), agentsRewards, maxDepth);
+
+      for (const auto& loss : losses) {
+        std::lock_guard<std::mutex> lock(loss.node->m_mutex);
+        removeVirtualLoss(loss, virtualLoss);
+        if (loss.node == root.get()) {
+          addVirtualVisits(rootVirtualVisits, loss.actionIds, -virtualLoss);
+        }
+      }
+
+      //### PHASE 4 BACKPROPAGATION
+      updatePolicy->updateSharedTree(leaf, agentsRewards, simDepth);
+
+      // stop early once the best actions at the root can no longer be overturned
+      const auto completed = ++nCompleted;
+      if (earlyStopping.active && completed % checkInterval == 0) {
+        std::lock_guard<std::mutex> lock(root->m_mutex);
+        if (isConverged(root.get(), bestActions, cOpt().n_iterations - completed,
+                        rootVirtualVisits)) {
+          converged = true;
+        }
+      }
+    }
+  };
+
+  std::vector<std::future<void>> futures;
+  for (unsigned int t = 1; t <= nThreads; ++t) {
+    futures.push_back(threadPool.submit([&search, t] { search(t); }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+  // return the entire search tree
+  return root;
+}
+
 //##########################################################################
 //### MAIN ENTRY POINT: applies the MCTS and returns the best actionSetSequence
 //##########################################################################
@@ -143,43 +472,64 @@ std::unique_ptr<Node> computeTree(std::unique_ptr<Node> root) {
  *
  * @param rootNode The pointer to the root node.
  * @param step The planning current planning step.
+ * @param context The search context of the planner.
  * @return actionSetSequence The action set sequence containing the finally selected actions.
  */
-ActionSetSequence computeActionSetSequence(std::unique_ptr<Node> rootNode, int step) {
+ActionSetSequence computeActionSetSequence(std::unique_ptr<Node> rootNode, int step,
+                                           SearchContext& context) {
   // the actionSetSequence that is returned by this function. It contains best action sets that
   // shall be executed successively.
   ActionSetSequence actionSetSequence;
   // root node of the final search tree
   std::unique_ptr<Node> rootFinal;
+  // root nodes of the root parallelization
+  std::vector<std::unique_ptr<Node>> roots;
 
   // Set the seed for the thread-safe random engine
   // Multiply seed by step to be pseudo-random between planning steps
   /// @todo consider removal, this does currently not add any benefit
   math::Random::g_seed = cOpt().random_seed + step * 1151;
 
-  unsigned int nThreads{cOpt().parallelization_options.n_threads};
-  if (nThreads > 1) {
+  const auto& parallelizationOptions = cOpt().parallelization_options;
+  unsigned int nThreads{parallelizationOptions.n_threads};
+  if (parallelizationOptions.mode != "root" && parallelizationOptions.mode != "tree") {
+    throw std::invalid_argument("Unknown parallelization mode: " + parallelizationOptions.mode);
+  }
+  const bool rootParallelization{nThreads > 1 && parallelizationOptions.mode == "root"};
+  // tree reuse is only supported without root parallelization
+  const bool treeReuse{cOpt().policy_options.policy_enhancements.tree_reuse.active &&
+                       !rootParallelization};
+  if (treeReuse) {
+    rootNode = context.reuseTree(std::move(rootNode), step);
+  }
+  // every iteration visits the root once, the visits of a reused tree are not counted
+  const unsigned int initialVisits{rootNode->m_visits};
+  unsigned int nIterations{0};
+
+  if (rootParallelization) {
     //### FUTURES FOR ROOT PARALLELIZATION
     // create futures
     std::vector<std::future<std::unique_ptr<Node>>> rootFutures;
-    std::vector<std::unique_ptr<Node>> roots(nThreads);
+    roots.resize(nThreads);
     for (unsigned int t = 0; t < nThreads; ++t) {
       roots[t] = std::make_unique<Node>(rootNode.get());
     }
     for (unsigned int t = 1; t <= nThreads; ++t) {
       // create a lambda function for the root parallelization
-      auto func = [t, rootInLambda = &roots[t - 1], step]() -> std::unique_ptr<Node> {
+      auto func = [t, rootInLambda = &roots[t - 1], step,
+                   &threadPool = context.threadPool()]() -> std::unique_ptr<Node> {
         // multiply thread id with random number and bit shift the step to create a random salt
         math::Random::setSalt((t * 11779) + (step << 13));
-        return computeTree(std::move(*rootInLambda));
+        return computeTree(std::move(*rootInLambda), threadPool);
       };
-      // push back the jobs and start the processing
-      rootFutures.push_back(std::async(std::launch::async, func));
+      // push back the jobs and start the processing on the persistent thread pool
+      rootFutures.push_back(context.threadPool().submit(func));
     }
 
     // collect the results of the futures
     for (unsigned int t = 0; t < nThreads; ++t) {
       roots[t] = rootFutures[t].get();
+      nIterations += roots[t]->m_visits - initialVisits;
     }
     if (cOpt().parallelization_options.similarity_voting) {
       actionSetSequence = similarityVoting(roots);
@@ -189,7 +539,10 @@ ActionSetSequence computeActionSetSequence(std::unique_ptr<Node> rootNode, int s
     //### FOR EVALUATION PURPOSES SET ROOTFINAL TO ONE OF THE ROOTS
     rootFinal = std::move(roots[0]);
   } else {
-    rootFinal = computeTree(std::move(rootNode));
+    rootFinal = nThreads > 1 ? computeSharedTree(std::move(rootNode), nThreads, step,
+                                                 context.threadPool())
+                             : computeTree(std::move(rootNode), context.threadPool());
+    nIterations = rootFinal->m_visits - initialVisits;
 
     // node that is used for the final selection, corresponds to the root node of the final search
     // tree
@@ -201,6 +554,8 @@ ActionSetSequence computeActionSetSequence(std::unique_ptr<Node> rootNode, int s
     actionSetSequence = finalSelectionPolicy->getBestPlan(nodeFinalSelection);
   }
 
+  context.setLastIterationCount(nIterations);
+
   if (oOpt().hasExportType("tree")) {
     rootFinal->exportTree(step);
   }
@@ -217,6 +572,13 @@ ActionSetSequence computeActionSetSequence(std::unique_ptr<Node> rootNode, int s
       rootFinal->exportMoveGroups(step);
     }
   }
+
+  if (treeReuse && !actionSetSequence.empty()) {
+    context.retainTree(std::move(rootFinal), actionSetSequence[0], step);
+  }
+  // the search trees are released in the background, the planner can continue right away
+  roots.push_back(std::move(rootFinal));
+  context.releaseTrees(std::move(roots));
   return actionSetSequence;
 }
 
@@ -235,26 +597,28 @@ void similarityUpdate(Node* const master, const Node* const node) {
     float q_old{0.0f};
     float n_other{0.0f};
     float q_other{0.0f};
-    // masterActionPtr, masterActionValue
-    for (auto& [masterActionPtr, masterActionValue] :
-         master->m_agents[agentIndex].m_actionValues) {  // nodeActionPtr, nodeActionValue
-      for (const auto& [nodeActionPtr, nodeActionValue] :
-           node->m_agents[agentIndex].m_actionValues) {
-        similarity = Action::getSimilarity(masterActionPtr, nodeActionPtr);
-        n_old      = master->m_agents[agentIndex].m_actionVisits.at(masterActionPtr);
-        q_old      = masterActionValue;
-        n_other    = node->m_agents[agentIndex].m_actionVisits.at(nodeActionPtr);
-        q_other    = nodeActionValue;
+    auto& masterStatistics     = master->m_agents[agentIndex].m_actionStatistics;
+    const auto& nodeStatistics = node->m_agents[agentIndex].m_actionStatistics;
+    for (size_t iMaster = 0; iMaster < masterStatistics.size(); ++iMaster) {
+      for (size_t iNode = 0; iNode < nodeStatistics.size(); ++iNode) {
+        similarity = Action::getSimilarity(masterStatistics.m_actions[iMaster],
+                                           nodeStatistics.m_actions[iNode]);
+        n_old      = masterStatistics.m_visits[iMaster];
+        q_old      = masterStatistics.m_values[iMaster];
+        n_other    = nodeStatistics.m_visits[iNode];
+        q_other    = nodeStatistics.m_values[iNode];
         // skip calculation for low similarities
         if (similarity > 0.1) {
           n_new = n_old + similarity * n_other;
           // calculation of q_new
-          masterActionValue = 1 / n_new * (q_old * n_old + q_other * similarity * n_other);
+          masterStatistics.m_values[iMaster] =
+              1 / n_new * (q_old * n_old + q_other * similarity * n_other);
           // set n_new
-          master->m_agents[agentIndex].m_actionVisits.at(masterActionPtr) = n_new;
+          masterStatistics.m_visits[iMaster] = n_new;
         }
       }
     }
+    masterStatistics.invalidate();
   }
 }
 
@@ -267,12 +631,16 @@ void similarityUpdate(Node* const master, const Node* const node) {
 void mergeTrees(Node* const master, const Node* const node) {
   master->m_visits += node->m_visits;
   for (unsigned int agentIndex = 0; agentIndex < master->m_agents.size(); ++agentIndex) {
-    master->m_agents[agentIndex].m_actionValues.insert(
-        node->m_agents[agentIndex].m_actionValues.begin(),
-        node->m_agents[agentIndex].m_actionValues.end());
-    master->m_agents[agentIndex].m_actionVisits.insert(
-        node->m_agents[agentIndex].m_actionVisits.begin(),
-        node->m_agents[agentIndex].m_actionVisits.end());
+    auto& masterStatistics     = master->m_agents[agentIndex].m_actionStatistics;
+    const auto& nodeStatistics = node->m_agents[agentIndex].m_actionStatistics;
+    for (size_t i = 0; i < nodeStatistics.size(); ++i) {
+      // actions that already exist in the master node keep their statistics
+      if (masterStatistics.contains(nodeStatistics.m_actions[i])) continue;
+      const auto iMaster{masterStatistics.add(nodeStatistics.m_actions[i])};
+      masterStatistics.m_values[iMaster] = nodeStatistics.m_values[i];
+      masterStatistics.m_visits[iMaster] = nodeStatistics.m_visits[i];
+    }
+    masterStatistics.invalidate();
   }
 }
 
@@ -346,8 +714,9 @@ ActionSetSequence similarityVoting(const std::vector<std::unique_ptr<Node>>& res
   for (size_t t = 0; t < size; ++t) {
     for (size_t s = 0; s < size; ++s) {
       for (size_t a = 0; a < agentsSize; ++a) {
-        similarities[t][s][a] = Action::getSimilarity(bestActions[t][a], bestActions[s][a]) *
-                                resultRoots[s]->m_agents[a].m_actionValues.at(bestActions[s][a]);
+        similarities[t][s][a] =
+            Action::getSimilarity(bestActions[t][a], bestActions[s][a]) *
+            resultRoots[s]->m_agents[a].m_actionStatistics.value(bestActions[s][a]);
       }
     }
   }
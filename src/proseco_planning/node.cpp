@@ -1,7 +1,10 @@
 #include "proseco_planning/node.h"
 
 #include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -19,6 +22,8 @@
 #include "proseco_planning/config/outputOptions.h"
 #include "proseco_planning/config/scenarioOptions.h"
 #include "proseco_planning/trajectory/trajectory.h"
+#include "proseco_planning/trajectory/trajectoryMemo.h"
+#include "proseco_planning/trajectory/trajectorygenerator.h"
 #include "proseco_planning/util/json.h"
 #include "proseco_planning/util/utilities.h"
 
@@ -51,17 +56,18 @@ Node::Node(const std::vector<config::Agent>& agents) : m_parent(nullptr), m_visi
  * In general, a new child node should be created and added to the search tree with the method
  * `Node::addChild`.
  *
- * @param actionSet actionSet that leads from the parent node to this child node.
+ * @param actionIds The ids of the actions that lead from the parent node to this child node.
  * @param parent Pointer to the parent node.
  */
 // child node constructor
-Node::Node(const ActionSet& actionSet, Node* const parent)
+Node::Node(const ActionIdSet& actionIds, Node* const parent)
 
-    : m_actionSet(actionSet),
+    : m_actionIds(actionIds),
       m_parent(parent),
       m_agents(parent->m_agents),
       m_visits(0),
-      m_depth(parent->m_depth + 1) {}
+      m_depth(parent->m_depth + 1),
+      m_arena(parent->m_arena) {}
 
 /**
  * @brief Copy constructor that is used for the creation of a `simulationNode`.
@@ -70,14 +76,15 @@ Node::Node(const ActionSet& actionSet, Node* const parent)
  */
 // copy constructor for simulationNode
 Node::Node(const Node* node)
-    : m_actionSet(node->m_actionSet),
+    : m_actionIds(node->m_actionIds),
       m_parent(node->m_parent),
       m_agents(node->m_agents),
       m_visits(node->m_visits),
       m_depth(node->m_depth),
       m_collision(node->m_collision),
       m_invalid(node->m_invalid),
-      m_terminal(node->m_terminal) {}
+      m_terminal(node->m_terminal),
+      m_executed(node->m_executed) {}
 
 /**
  * @brief Checks whether the node has children.
@@ -94,9 +101,31 @@ bool Node::hasChildren() const { return !m_childMap.empty(); }
  * @param collisionChecker The collision checker used for the collision check.
  */
 void Node::checkCollision(CollisionChecker& collisionChecker) {
-  for (auto& agent_i : m_agents) {
-    // Check for collision with other agents
-    for (auto& agent_j : m_agents) {
+  // Check for collision with other agents
+  checkAgentCollision(collisionChecker);
+
+  // Check for collision with obstacles
+  for (auto& agent : m_agents) {
+    if (collisionChecker.collision(agent.m_vehicle, agent.m_trajectory, sOpt().obstacles)) {
+      agent.m_collision = true;
+      m_collision       = true;
+    }
+  }
+}
+
+/**
+ * @brief Checks whether a collision between agents is occurring and sets the member `m_collision`
+ * accordingly.
+ *
+ * @param collisionChecker The collision checker used for the collision check.
+ * @param memo The memo of the parent node for looking up and storing the results of the collision
+ * checks of the actions of this node, nullptr for checking all agents.
+ */
+void Node::checkAgentCollision(CollisionChecker& collisionChecker, TrajectoryMemo* const memo) {
+  for (size_t i = 0; i < m_agents.size(); ++i) {
+    auto& agent_i = m_agents[i];
+    for (size_t j = 0; j < m_agents.size(); ++j) {
+      auto& agent_j = m_agents[j];
       // compare two agents, use "<" to avoid duplicate comparison
       if (agent_i.m_id < agent_j.m_id) {
         // avoid collision check for two predefined agents
@@ -104,8 +133,18 @@ void Node::checkCollision(CollisionChecker& collisionChecker) {
           continue;
         }
 
-        if (collisionChecker.collision(agent_i.m_vehicle, agent_i.m_trajectory, agent_j.m_vehicle,
-                                       agent_j.m_trajectory)) {
+        std::optional<bool> collision;
+        if (memo != nullptr) {
+          collision = memo->findCollision(i, m_actionIds[i], j, m_actionIds[j]);
+        }
+        if (!collision) {
+          collision = collisionChecker.collision(agent_i.m_vehicle, agent_i.m_trajectory,
+                                                 agent_j.m_vehicle, agent_j.m_trajectory);
+          if (memo != nullptr) {
+            memo->insertCollision(i, m_actionIds[i], j, m_actionIds[j], *collision);
+          }
+        }
+        if (*collision) {
           agent_i.m_collision = true;
           agent_j.m_collision = true;
           // if any agent is in collision the state/node is in collision
@@ -113,12 +152,6 @@ void Node::checkCollision(CollisionChecker& collisionChecker) {
         }
       }
     }
-
-    // Check for collision with obstacles
-    if (collisionChecker.collision(agent_i.m_vehicle, agent_i.m_trajectory, sOpt().obstacles)) {
-      agent_i.m_collision = true;
-      m_collision         = true;
-    }
   }
 }
 
@@ -163,11 +196,17 @@ bool Node::checkInitForCollisions() {
  * agents have to check for their valid action space
  * aggregated action space has to be updated
  *
- * @param actionSet actionSet that leads from this node to the new child node
+ * @param actionIds The ids of the actions that lead from this node to the new child node.
  * @return Pointer to the new child node.
  */
-Node* Node::addChild(const ActionSet& actionSet) {
-  auto child = std::make_unique<Node>(actionSet, this);
+Node* Node::addChild(const ActionIdSet& actionIds) {
+  auto child = nodeArena().create(actionIds, this);
+
+  // the children share the executed actions of the agents, unless noise is added to the state of
+  // this node before every expansion
+  if (m_trajectoryMemo == nullptr && !cOpt().noise.active) {
+    m_trajectoryMemo = std::make_unique<TrajectoryMemo>(m_agents.size());
+  }
 
   // update the executable actions of all agents
   for (auto& agent : child->m_agents) {
@@ -178,19 +217,241 @@ Node* Node::addChild(const ActionSet& actionSet) {
   }
 
   // update childmap
-  auto childPtr = child.get();
-  m_childMap.insert(std::make_pair(actionSet, std::move(child)));
+  m_childMap.insert(actionIds, child);
 
-  return childPtr;
+  return child;
 }
 
+/**
+ * @brief Creates and adds a new child node. Actions that are not part of the action statistics of
+ * the agents yet are added to them.
+ *
+ * @param actionSet actionSet that leads from this node to the new child node
+ * @return Pointer to the new child node.
+ */
+Node* Node::addChild(const ActionSet& actionSet) { return addChild(addActionSet(actionSet)); }
+
+/**
+ * @brief Returns the child node that is reached by the given action ids.
+ *
+ * @param actionIds The ids of the actions that lead to the child node.
+ * @return Node* The pointer to the child node.
+ * @throws std::out_of_range If the child does not exist.
+ */
+Node* Node::getChild(const ActionIdSet& actionIds) const { return m_childMap.at(actionIds); }
+
 /**
  * @brief Returns the child node that is reached by the given action set.
  *
  * @param actionSet The action set that leads to the child node.
  * @return Node* The pointer to the child node.
+ * @throws std::out_of_range If the child does not exist.
  */
-Node* Node::getChild(const ActionSet& actionSet) const { return m_childMap.at(actionSet).get(); }
+Node* Node::getChild(const ActionSet& actionSet) const {
+  return m_childMap.at(findActionIds(actionSet));
+}
+
+/**
+ * @brief Returns the child node that is reached by the given action set.
+ *
+ * @param actionSet The action set that leads to the child node.
+ * @return Node* The pointer to the child node, nullptr if the child does not exist.
+ */
+Node* Node::findChild(const ActionSet& actionSet) const {
+  return m_childMap.find(findActionIds(actionSet));
+}
+
+/**
+ * @brief Returns the ids of the actions of an action set, i.e. the indices of the actions in the
+ * action statistics of the agents.
+ *
+ * @param actionSet The action set.
+ * @return ActionIdSet The action ids, empty if an action is not part of the action statistics.
+ */
+ActionIdSet Node::findActionIds(const ActionSet& actionSet) const {
+  ActionIdSet actionIds;
+  if (actionSet.size() != m_agents.size()) return actionIds;
+
+  actionIds.reserve(actionSet.size());
+  for (size_t i = 0; i < actionSet.size(); ++i) {
+    const auto actionIdx = m_agents[i].m_actionStatistics.find(actionSet[i]);
+    if (actionIdx == ActionStatistics::npos) return {};
+    actionIds.push_back(static_cast<ActionId>(actionIdx));
+  }
+  return actionIds;
+}
+
+/**
+ * @brief Returns the ids of the actions of an action set and adds the actions that are not part of
+ * the action statistics of the agents yet.
+ *
+ * @param actionSet The action set.
+ * @return ActionIdSet The action ids.
+ */
+ActionIdSet Node::addActionSet(const ActionSet& actionSet) {
+  ActionIdSet actionIds;
+  actionIds.reserve(actionSet.size());
+  for (size_t i = 0; i < actionSet.size(); ++i) {
+    actionIds.push_back(static_cast<ActionId>(m_agents[i].m_actionStatistics.add(actionSet[i])));
+  }
+  return actionIds;
+}
+
+/**
+ * @brief Returns the action set of the action ids.
+ *
+ * @param actionIds The action ids, referring to the action statistics of the agents of this node.
+ * @return ActionSet The action set.
+ */
+ActionSet Node::actionSet(const ActionIdSet& actionIds) const {
+  ActionSet actionSet;
+  actionSet.reserve(actionIds.size());
+  for (size_t i = 0; i < actionIds.size(); ++i) {
+    actionSet.push_back(m_agents[i].m_actionStatistics.m_actions[actionIds[i]]);
+  }
+  return actionSet;
+}
+
+/**
+ * @brief Returns the action set that led to the node.
+ *
+ * @return ActionSet The action set, empty for the root node.
+ */
+ActionSet Node::actionSet() const {
+  return m_parent != nullptr ? m_parent->actionSet(m_actionIds) : ActionSet{};
+}
+
+/**
+ * @brief Creates the node arena that owns all descendants of this node with capacity for `nNodes`
+ * nodes, so that the search tree is built without a heap allocation per node and released in a
+ * single sweep together with this node.
+ * @note Has no effect if the arena already exists.
+ *
+ * @param nNodes The number of nodes to reserve.
+ * @param hugePages Flag for backing the arena with transparent huge pages.
+ */
+void Node::reserveNodes(const std::size_t nNodes, const bool hugePages) {
+  if (m_arena == nullptr) {
+    m_nodeArena = std::make_unique<util::Arena<Node>>(nNodes, hugePages);
+    m_arena     = m_nodeArena.get();
+  }
+}
+
+/**
+ * @brief Returns the lookup statistics of the trajectory memos of this node and all its
+ * descendants.
+ *
+ * @return TrajectoryMemo::Statistics The summed lookup statistics.
+ */
+TrajectoryMemo::Statistics Node::trajectoryMemoStatistics() const {
+  TrajectoryMemo::Statistics statistics;
+  if (m_trajectoryMemo != nullptr) statistics += m_trajectoryMemo->statistics();
+  for (const auto child : m_childMap) {
+    statistics += child->trajectoryMemoStatistics();
+  }
+  return statistics;
+}
+
+/**
+ * @brief Checks whether the agents of this node are in the same state as the agents of another
+ * node, within the specified tolerances.
+ * @note The difference of the headings is wrapped to [-pi, pi].
+ *
+ * @param node The node to compare with.
+ * @param maxPositionDrift The maximum deviation of the positions.
+ * @param maxVelocityDrift The maximum deviation of the velocities.
+ * @param maxAccelerationDrift The maximum deviation of the accelerations.
+ * @param maxHeadingDrift The maximum deviation of the headings.
+ * @return true If all agents match.
+ * @return false Otherwise.
+ */
+bool Node::matchesState(const Node& node, const float maxPositionDrift,
+                        const float maxVelocityDrift, const float maxAccelerationDrift,
+                        const float maxHeadingDrift) const {
+  if (m_agents.size() != node.m_agents.size()) return false;
+
+  for (size_t i = 0; i < m_agents.size(); ++i) {
+    const auto& vehicle      = m_agents[i].m_vehicle;
+    const auto& otherVehicle = node.m_agents[i].m_vehicle;
+    if (m_agents[i].m_id != node.m_agents[i].m_id ||
+        std::abs(vehicle.m_positionX - otherVehicle.m_positionX) > maxPositionDrift ||
+        std::abs(vehicle.m_positionY - otherVehicle.m_positionY) > maxPositionDrift ||
+        std::abs(vehicle.m_velocityX - otherVehicle.m_velocityX) > maxVelocityDrift ||
+        std::abs(vehicle.m_velocityY - otherVehicle.m_velocityY) > maxVelocityDrift ||
+        std::abs(vehicle.m_accelerationX - otherVehicle.m_accelerationX) > maxAccelerationDrift ||
+        std::abs(vehicle.m_accelerationY - otherVehicle.m_accelerationY) > maxAccelerationDrift ||
+        std::abs(std::remainder(vehicle.m_heading - otherVehicle.m_heading, 2.0 * M_PI)) >
+            maxHeadingDrift) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Turns this root node into the root of the subtree below `node`, a node of the search tree
+ * of a previous planning step. The agents keep their (observed) vehicle states, but take over the
+ * statistics of the actions, while the descendants of `node` are rebuilt in the arena of this node.
+ * The previous search tree can be released afterwards.
+ * @details The descendants take over the visits and the action statistics of their counterparts,
+ * but their available actions and states are recomputed starting from the observed states, just
+ * as if they had been expanded from this node. The actions keep their ids, see
+ * `Agent::reuseActions`.
+ *
+ * @param node The node whose subtree is reused.
+ * @param collisionChecker The collision checker.
+ * @param trajectoryGenerator The trajectory generator.
+ */
+void Node::reuseSubtree(const Node* const node, CollisionChecker& collisionChecker,
+                        const TrajectoryGenerator& trajectoryGenerator) {
+  m_visits = node->m_visits;
+  for (size_t i = 0; i < std::min(m_agents.size(), node->m_agents.size()); ++i) {
+    m_agents[i].reuseActions(node->m_agents[i], m_depth);
+  }
+  for (const auto child : node->m_childMap) {
+    adoptChild(child, collisionChecker, trajectoryGenerator);
+  }
+}
+
+/**
+ * @brief Adds a child node that takes over the statistics and the descendants of a node of another
+ * search tree. The state of the child is obtained by executing the actions of `node` in this node.
+ *
+ * @param node The node whose statistics and descendants are taken over.
+ * @param collisionChecker The collision checker.
+ * @param trajectoryGenerator The trajectory generator.
+ */
+void Node::adoptChild(const Node* const node, CollisionChecker& collisionChecker,
+                      const TrajectoryGenerator& trajectoryGenerator) {
+  auto child      = nodeArena().create(node->m_actionIds, this);
+  child->m_visits = node->m_visits;
+
+  // the available actions are determined before the execution, like in `Node::addChild`
+  for (size_t i = 0; i < std::min(child->m_agents.size(), node->m_agents.size()); ++i) {
+    child->m_agents[i].reuseActions(node->m_agents[i], m_depth);
+  }
+  child->executeActions(actionSet(node->m_actionIds), collisionChecker, trajectoryGenerator,
+                        false);
+  m_childMap.insert(node->m_actionIds, child);
+
+  for (const auto grandChild : node->m_childMap) {
+    child->adoptChild(grandChild, collisionChecker, trajectoryGenerator);
+  }
+}
+
+/**
+ * @brief Returns the arena the children of this node are allocated from and creates it if the node
+ * does not belong to an arena yet.
+ *
+ * @return util::Arena<Node>& The node arena.
+ */
+util::Arena<Node>& Node::nodeArena() {
+  if (m_arena == nullptr) {
+    m_nodeArena = std::make_unique<util::Arena<Node>>();
+    m_arena     = m_nodeArena.get();
+  }
+  return *m_arena;
+}
 
 /**
  * @brief execute actions for all agents. This node is adjusted so that it represents the state
@@ -207,14 +468,47 @@ void Node::executeActions(const ActionSet& actionSet, CollisionChecker& collisio
   // Set the trajectory flag for executing the complete action or only a fraction
   Trajectory::useActionFraction = executeFraction;
 
+  // a child that has not been executed yet starts from the state of its parent, hence the executed
+  // actions of the agents can be shared with the other children of the parent
+  TrajectoryMemo* const memo{!m_executed && !executeFraction && m_parent != nullptr &&
+                                     m_actionIds.size() == actionSet.size()
+                                 ? m_parent->m_trajectoryMemo.get()
+                                 : nullptr};
+  m_executed = true;
+
   // generate the action set of all agents and set the state variables but don't yet simulate
   for (size_t i = 0; i < std::min(m_agents.size(), actionSet.size()); ++i) {
-    m_agents[i].setAction(actionSet[i], trajectoryGenerator);
+    auto& agent = m_agents[i];
+    bool obstacleCollision{false};
+    if (memo == nullptr) {
+      agent.setAction(actionSet[i], trajectoryGenerator);
+      obstacleCollision =
+          collisionChecker.collision(agent.m_vehicle, agent.m_trajectory, sOpt().obstacles);
+    } else {
+      assert(m_parent->m_agents[i].m_actionStatistics.m_actions[m_actionIds[i]] == actionSet[i] &&
+             "action set does not match the action ids of the node");
+      auto entry = memo->find(i, m_actionIds[i]);
+      if (entry == nullptr) {
+        agent.setAction(actionSet[i], trajectoryGenerator);
+        entry = memo->insert(
+            i, m_actionIds[i],
+            {agent.m_trajectory, agent.m_actionCost,
+             collisionChecker.collision(agent.m_vehicle, agent.m_trajectory, sOpt().obstacles)});
+      } else {
+        agent.setAction(entry->trajectory, entry->actionCost);
+      }
+      obstacleCollision = entry->obstacleCollision;
+    }
+    // Check for collision with obstacles
+    if (obstacleCollision) {
+      agent.m_collision = true;
+      m_collision       = true;
+    }
   }
 
-  // check the state for collisions and update the state as well as the agents
+  // check the state for collisions between the agents and update the state as well as the agents
   // state
-  checkCollision(collisionChecker);
+  checkAgentCollision(collisionChecker, memo);
   // check the state for validity and update the state as well as the agents
   // state
   checkValidity();
@@ -245,6 +539,39 @@ void Node::executeActions(const ActionSet& actionSet, CollisionChecker& collisio
   }
 }
 
+/**
+ * @brief Executes the available actions of all agents from the state of this node and stores the
+ * results in the trajectory memo, so that the children of this node do not generate them one at a
+ * time. The trajectories of the actions of each agent are created in one batch.
+ * @note Has no effect if noise is added to the state of this node before every expansion, see
+ * `Node::addChild`.
+ *
+ * @param collisionChecker The collision checker for the collision check with the obstacles.
+ * @param trajectoryGenerator The trajectory generator.
+ */
+void Node::memoizeAvailableActions(CollisionChecker& collisionChecker,
+                                   const TrajectoryGenerator& trajectoryGenerator) {
+  if (cOpt().noise.active) return;
+  if (m_trajectoryMemo == nullptr) {
+    m_trajectoryMemo = std::make_unique<TrajectoryMemo>(m_agents.size());
+  }
+
+  Trajectory::useActionFraction = false;
+  std::vector<Trajectory> trajectories;
+  for (size_t i = 0; i < m_agents.size(); ++i) {
+    const auto& agent = m_agents[i];
+    trajectoryGenerator.createTrajectories(0.0f, agent.m_availableActions, agent.m_vehicle,
+                                           trajectories);
+    for (size_t k = 0; k < trajectories.size(); ++k) {
+      const auto actionId = agent.m_actionStatistics.index(agent.m_availableActions[k]);
+      m_trajectoryMemo->insert(
+          i, actionId,
+          {trajectories[k], agent.m_costModel->calculateActionCost(trajectories[k]),
+           collisionChecker.collision(agent.m_vehicle, trajectories[k], sOpt().obstacles)});
+    }
+  }
+}
+
 /**
  * @brief Checks for validity of the state and action and sets the member `m_invalid` accordingly.
  *
@@ -294,20 +621,20 @@ void Node::checkTerminality() {
  * @brief Calculates statistics for collisions, invalid actions and action count.
  *
  * @param childMap The child map for the current action.
- * @param action
+ * @param actionId
  * @param agentIdx
  * @return std::tuple<float, float, float>
  */
 std::tuple<float, float, float> Node::calculateActionStatistics(
-    const std::map<ActionSet, std::unique_ptr<Node>>& childMap, const ActionPtr& action,
-    const int agentIdx) {
+    const ChildIndex& childMap, const ActionId actionId, const int agentIdx) {
   float actionCount{0.0f};
   float invalidCount{0.0f};
   float collisionCount{0.0f};
 
-  for (const auto& [actionSet, childPtr] : childMap) {
+  for (size_t i = 0; i < childMap.size(); ++i) {
+    const auto childPtr = childMap.child(i);
     // if the action at the agentIdx is equal to the action
-    if (actionSet.at(agentIdx) == action) {
+    if (childMap.actionId(i, agentIdx) == actionId) {
       // count number of times action has been executed
       ++actionCount;
       if (childPtr->m_invalid) {
@@ -341,11 +668,14 @@ json Node::childMapToJSON(const ActionSet& bestActionSet) const {
     json jAgentInfo;
     jAgentInfo["id"]      = agent.m_id;
     jAgentInfo["actions"] = json::array();
-    for (const auto& [action, value] : agent.m_actionValues) {
+    const auto& statistics = agent.m_actionStatistics;
+    for (size_t actionIdx{}; actionIdx < statistics.size(); ++actionIdx) {
+      const auto& action  = statistics.m_actions[actionIdx];
+      const auto classIdx = statistics.m_classIds[actionIdx];
       // calculate the probability of collision, invalid and the number of combinations for this
       // action
       const auto [collisionProbability, invalidProbability, actionCount] =
-          calculateActionStatistics(m_childMap, action, agentIdx);
+          calculateActionStatistics(m_childMap, actionIdx, agentIdx);
 
       json jActionInfo;
       // determine if this action is the finally chosen one
@@ -355,15 +685,15 @@ json Node::childMapToJSON(const ActionSet& bestActionSet) const {
       jActionInfo["d_lateral"]     = action->m_lateralChange;
 
       // extract action information
-      jActionInfo["action_value"]  = value;
-      jActionInfo["action_uct"]    = agent.m_actionUCT.at(action);
-      jActionInfo["action_visits"] = agent.m_actionVisits.at(action);
+      jActionInfo["action_value"]  = statistics.m_values[actionIdx];
+      jActionInfo["action_uct"]    = statistics.uctScores(cOpt().uct_cp)[actionIdx];
+      jActionInfo["action_visits"] = statistics.m_visits[actionIdx];
 
       // extract action class information
-      jActionInfo["class_count"]  = agent.m_actionClassCount.at(action->m_actionClass);
-      jActionInfo["class_value"]  = agent.m_actionClassValues.at(action->m_actionClass);
-      jActionInfo["class_uct"]    = agent.m_actionClassUCT.at(action->m_actionClass);
-      jActionInfo["class_visits"] = agent.m_actionClassVisits.at(action->m_actionClass);
+      jActionInfo["class_count"]  = statistics.m_classCount[classIdx];
+      jActionInfo["class_value"]  = statistics.m_classValues[classIdx];
+      jActionInfo["class_uct"]    = statistics.m_classUCT[classIdx];
+      jActionInfo["class_visits"] = statistics.m_classVisits[classIdx];
 
       // extract information about action validity
       jActionInfo["collision_prob"] = collisionProbability;
@@ -396,7 +726,8 @@ json Node::permutationMapToJSON(const ActionSet& bestActionSet) const {
         {{"id", m_agents[agentID].m_id}, {"actions", json::array()}});
   }
 
-  for (const auto& [actionPtrVec, nodePtr] : m_childMap) {
+  for (const auto nodePtr : m_childMap) {
+    const auto actionPtrVec = nodePtr->actionSet();
     for (size_t agent_j{}; agent_j < m_agents.size(); ++agent_j) {
       // get all nodes which contain the chosen action of agent_j
       if (bestActionSet[agent_j] == actionPtrVec[agent_j]) {
@@ -405,11 +736,11 @@ json Node::permutationMapToJSON(const ActionSet& bestActionSet) const {
           json jActionInfo;
           jActionInfo["action_chosen"] = (agent_i == agent_j);
           jActionInfo["action_class"] =
-              ActionSpace::ACTION_CLASS_NAME_MAP.at(nodePtr->m_actionSet[agent_i]->m_actionClass);
-          jActionInfo["d_velocity"]   = nodePtr->m_actionSet[agent_i]->m_velocityChange;
-          jActionInfo["d_lateral"]    = nodePtr->m_actionSet[agent_i]->m_lateralChange;
+              ActionSpace::ACTION_CLASS_NAME_MAP.at(actionPtrVec[agent_i]->m_actionClass);
+          jActionInfo["d_velocity"]   = actionPtrVec[agent_i]->m_velocityChange;
+          jActionInfo["d_lateral"]    = actionPtrVec[agent_i]->m_lateralChange;
           jActionInfo["state_visits"] = nodePtr->m_visits;
-          jActionInfo["node_ptr"]     = (long long)nodePtr.get();
+          jActionInfo["node_ptr"]     = (long long)nodePtr;
           // add action data to the action array of agent i
           jPermutationMap["agents"][agent_i]["actions"].push_back(jActionInfo);
         }
@@ -435,7 +766,9 @@ json Node::moveGroupsToJSON() const {
     json jAgentInfo;
     jAgentInfo["id"]             = agent.m_id;
     jAgentInfo["action_classes"] = json::array();
-    for (const auto& [actionClass, value] : agent.m_actionClassUCT) {
+    const auto& statistics = agent.m_actionStatistics;
+    for (size_t classIdx{}; classIdx < statistics.nClasses(); ++classIdx) {
+      const auto actionClass = statistics.m_classes[classIdx];
       json jActionClassInfo;
       jActionClassInfo["id"] = ActionSpace::ACTION_CLASS_NAME_MAP.at(actionClass);
 
@@ -452,10 +785,10 @@ json Node::moveGroupsToJSON() const {
         jActionClassInfo["lateral_change_max"]  = boundary.lateralChange.max;
       }
 
-      jActionClassInfo["value"]       = agent.m_actionClassValues.at(actionClass);
-      jActionClassInfo["uct"]         = agent.m_actionClassUCT.at(actionClass);
-      jActionClassInfo["visit_count"] = agent.m_actionClassVisits.at(actionClass);
-      jActionClassInfo["class_count"] = agent.m_actionClassCount.at(actionClass);
+      jActionClassInfo["value"]       = statistics.m_classValues[classIdx];
+      jActionClassInfo["uct"]         = statistics.m_classUCT[classIdx];
+      jActionClassInfo["visit_count"] = statistics.m_classVisits[classIdx];
+      jActionClassInfo["class_count"] = statistics.m_classCount[classIdx];
 
       jAgentInfo["action_classes"].push_back(jActionClassInfo);
     }
@@ -550,7 +883,7 @@ void Node::exportMoveGroups(const int step) const {
  * @return json The node as JSON.
  */
 json Node::treeNodeToJSON() const {
-  std::string nameString = util::actionSetToString(m_actionSet) + "v" +
+  std::string nameString = util::actionSetToString(actionSet()) + "v" +
                            util::toStringPrecision(m_agents[0].m_actionValue, 1) + ",n" +
                            std::to_string(m_visits);
   json jNode;
@@ -578,8 +911,8 @@ void Node::treeToJSON(const Node* const node, json& jTtree) {
   json jNode = node->treeNodeToJSON();
   if (node->hasChildren()) {
     jNode["children"] = json::array();
-    for (auto& [actionSet, child] : node->m_childMap) {
-      treeToJSON(child.get(), jNode["children"]);
+    for (const auto child : node->m_childMap) {
+      treeToJSON(child, jNode["children"]);
     }
   }
   if (jTtree.is_array()) {
@@ -629,7 +962,7 @@ void to_json(json& j, const Node& node) {
   j["invalid"]    = node.m_invalid;
   j["terminal"]   = node.m_terminal;
   j["parent"]     = util::pointerToString(node.m_parent);
-  j["action_set"] = node.m_actionSet;
+  j["action_set"] = node.actionSet();
   j["visits"]     = node.m_visits;
   j["depth"]      = node.m_depth;
   j["childMap"]   = node.m_childMap;
@@ -47,7 +47,8 @@ ActionSetSequence FinalSelectionPolicy::getBestPlan(const Node* nodeFinalSelecti
   ActionSet bestActionSet;
 
   // extract the whole plan
-  bool rootParallelizationActive{1 < cOpt().parallelization_options.n_threads};
+  bool rootParallelizationActive{1 < cOpt().parallelization_options.n_threads &&
+                                 cOpt().parallelization_options.mode == "root"};
   while (nodeFinalSelection != nullptr &&
          (!nodeFinalSelection->m_childMap.empty() || rootParallelizationActive)) {
     bestActionSet.clear();
@@ -55,14 +56,9 @@ ActionSetSequence FinalSelectionPolicy::getBestPlan(const Node* nodeFinalSelecti
 
     bestPlan.push_back(bestActionSet);
 
-    if (nodeFinalSelection->m_childMap.count(m_bestActionSet)) {
-      nodeFinalSelection = nodeFinalSelection->m_childMap.at(m_bestActionSet).get();
-    } else {
-      // if cannot find, the nodeFinalSelection is assigned with nullptr,
-      // which will terminate the while-loop
-      nodeFinalSelection = nullptr;
-      // std::cout << "node was not explored" << std::endl;
-    }
+    // if cannot find, the nodeFinalSelection is assigned with nullptr,
+    // which will terminate the while-loop
+    nodeFinalSelection = nodeFinalSelection->findChild(m_bestActionSet);
   }
   return bestPlan;
 }
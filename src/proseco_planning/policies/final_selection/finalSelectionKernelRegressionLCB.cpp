@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "proseco_planning/action/action.h"
+#include "proseco_planning/agent/actionStatistics.h"
 #include "proseco_planning/agent/agent.h"
 #include "proseco_planning/config/computeOptions.h"
 #include "proseco_planning/config/configuration.h"
@@ -61,24 +62,25 @@ void FinalSelectionKernelRegressionLCB::setBestActionClass(const Node* const nod
   m_bestActionClassSet.clear();
 
   for (const auto& agent : node->m_agents) {
+    const auto& statistics = agent.m_actionStatistics;
     // store the density and the weighted value for each action class
     std::vector<float> densities;
-    densities.reserve(agent.m_actionClassValues.size());
+    densities.reserve(statistics.nClasses());
     std::vector<float> weightedValues;
-    weightedValues.reserve(agent.m_actionClassValues.size());
+    weightedValues.reserve(statistics.nClasses());
 
     float sumDensities{0.0f};
 
     // calculate for each centerActionClass the density and weighted value
-    for (const auto& [centerClass, _] : agent.m_actionClassValues) {
+    for (const auto centerClass : statistics.m_classes) {
       float density{0.0f};
       float weightedValue{0.0f};
 
-      for (const auto& [compareClass, compareValue] : agent.m_actionClassValues) {
-        float similarity   = getSimilarity(centerClass, compareClass);
-        float densityDelta = similarity * agent.m_actionClassVisits.at(compareClass);
+      for (size_t iCompare = 0; iCompare < statistics.nClasses(); ++iCompare) {
+        float similarity   = getSimilarity(centerClass, statistics.m_classes[iCompare]);
+        float densityDelta = similarity * statistics.m_classVisits[iCompare];
         density += densityDelta;
-        weightedValue += densityDelta * compareValue;
+        weightedValue += densityDelta * statistics.m_classValues[iCompare];
       }
       // save results for centerActionClass
       densities.push_back(density);
@@ -98,9 +100,9 @@ void FinalSelectionKernelRegressionLCB::setBestActionClass(const Node* const nod
     else {
       // stores the kernel regression value for each action class
       std::vector<float> kernelRegValues;
-      kernelRegValues.reserve(agent.m_actionClassValues.size());
+      kernelRegValues.reserve(statistics.nClasses());
 
-      for (size_t i = 0; i < agent.m_actionClassValues.size(); ++i) {
+      for (size_t i = 0; i < statistics.nClasses(); ++i) {
         kernelRegValues.push_back(weightedValues.at(i) / densities.at(i));
       }
 
@@ -112,9 +114,7 @@ void FinalSelectionKernelRegressionLCB::setBestActionClass(const Node* const nod
       float currentMax{-std::numeric_limits<float>::max()};
       float logSumDensities{std::log(sumDensities)};
 
-      auto classValueIter = agent.m_actionClassValues.cbegin();
-      for (size_t iClass = 0; classValueIter != agent.m_actionClassValues.cend();
-           ++iClass, ++classValueIter) {
+      for (size_t iClass = 0; iClass < statistics.nClasses(); ++iClass) {
         // normalized kernel regression value
         // use a default value if maxKR == minKR
         float normKernelRegValue =
@@ -124,7 +124,7 @@ void FinalSelectionKernelRegressionLCB::setBestActionClass(const Node* const nod
                              m_cpActionClass * std::sqrt(logSumDensities / densities.at(iClass));
         if (currentValue > currentMax) {
           currentMax      = currentValue;
-          bestActionClass = classValueIter->first;
+          bestActionClass = statistics.m_classes[iClass];
         }
       }
     }
@@ -144,24 +144,26 @@ void FinalSelectionKernelRegressionLCB::setBestActionSet(const Node* const node)
 
   size_t iAgent = 0;  // loop index for agent
   for (const auto& agent : node->m_agents) {
+    const auto& statistics = agent.m_actionStatistics;
     // store the density and the weighted value for each action
     std::vector<float> densities;
-    densities.reserve(agent.m_actionValues.size());
+    densities.reserve(statistics.size());
     std::vector<float> weightedValues;
-    weightedValues.reserve(agent.m_actionValues.size());
+    weightedValues.reserve(statistics.size());
 
     float sumDensities{0.0f};
 
     // calculate for each centerAction the density and weighted value
-    for (const auto& [centerAction, _] : agent.m_actionValues) {
+    for (const auto& centerAction : statistics.m_actions) {
       float density{0.0f};
       float weightedValue{0.0f};
 
-      for (const auto& [compareAction, compareValue] : agent.m_actionValues) {
-        float similarity   = Action::getSimilarity(centerAction, compareAction, m_gammaAction);
-        float densityDelta = similarity * agent.m_actionVisits.at(compareAction);
+      for (size_t iCompare = 0; iCompare < statistics.size(); ++iCompare) {
+        float similarity =
+            Action::getSimilarity(centerAction, statistics.m_actions[iCompare], m_gammaAction);
+        float densityDelta = similarity * statistics.m_visits[iCompare];
         density += densityDelta;
-        weightedValue += densityDelta * compareValue;
+        weightedValue += densityDelta * statistics.m_values[iCompare];
       }
       // save results for centerAction
       densities.push_back(density);
@@ -180,9 +182,9 @@ void FinalSelectionKernelRegressionLCB::setBestActionSet(const Node* const node)
     else {
       // stores the kernel regression value for each action
       std::vector<float> kernelRegValues;
-      kernelRegValues.reserve(agent.m_actionValues.size());
+      kernelRegValues.reserve(statistics.size());
 
-      for (size_t i = 0; i < agent.m_actionValues.size(); ++i) {
+      for (size_t i = 0; i < statistics.size(); ++i) {
         kernelRegValues.push_back(weightedValues.at(i) / densities.at(i));
       }
 
@@ -195,13 +197,12 @@ void FinalSelectionKernelRegressionLCB::setBestActionSet(const Node* const node)
       float currentMax{-std::numeric_limits<float>::max()};
       float logSumDensities{std::log(sumDensities)};
 
-      auto actionValueIter = agent.m_actionValues.cbegin();
-      for (size_t iAction = 0; actionValueIter != agent.m_actionValues.cend();
-           ++iAction, ++actionValueIter) {
+      size_t bestClassId{ActionStatistics::npos};
+      if (m_moveGrouping) bestClassId = statistics.findClass(m_bestActionClassSet.at(iAgent));
+      for (size_t iAction = 0; iAction < statistics.size(); ++iAction) {
         // if move grouping is active, only actions which belong to the bestActionClass are
         // considered
-        if (m_moveGrouping &&
-            actionValueIter->first->m_actionClass != m_bestActionClassSet.at(iAgent)) {
+        if (m_moveGrouping && statistics.m_classIds[iAction] != bestClassId) {
           continue;
         }
         // normalized kernel regression value
@@ -213,7 +214,7 @@ void FinalSelectionKernelRegressionLCB::setBestActionSet(const Node* const node)
             normKernelRegValue - m_cpAction * std::sqrt(logSumDensities / densities.at(iAction));
         if (currentValue > currentMax) {
           currentMax = currentValue;
-          bestAction = actionValueIter->first;
+          bestAction = statistics.m_actions[iAction];
         }
       }
     }
@@ -24,12 +24,14 @@ ActionPtr FinalSelectionMaxActionValue::maxActionValueActionInActionClass(
     const Agent& agent, const ActionClass bestActionClass) {
   float maxActionValue{std::numeric_limits<float>::lowest()};
   ActionPtr bestAction{nullptr};
+  const auto& statistics = agent.m_actionStatistics;
+  const auto classId     = statistics.findClass(bestActionClass);
   // Iterate over all actions of the agent
-  for (const auto& [actionPtr, actionValue] : agent.m_actionValues) {
-    if (actionPtr->m_actionClass == bestActionClass) {
-      if (actionValue > maxActionValue) {
-        bestAction     = actionPtr;
-        maxActionValue = actionValue;
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    if (statistics.m_classIds[i] == classId) {
+      if (statistics.m_values[i] > maxActionValue) {
+        bestAction     = statistics.m_actions[i];
+        maxActionValue = statistics.m_values[i];
       }
     }
   }
@@ -25,12 +25,14 @@ ActionPtr FinalSelectionMaxVisitCount::maxVisitCountActionInActionClass(
     const Agent& agent, const ActionClass bestActionClass) {
   float maxVisitCount{0.0f};
   ActionPtr bestAction{nullptr};
+  const auto& statistics = agent.m_actionStatistics;
+  const auto classId     = statistics.findClass(bestActionClass);
   // Iterate over all actions of the agent
-  for (const auto& [actionPtr, actionVisits] : agent.m_actionVisits) {
-    if (actionPtr->m_actionClass == bestActionClass) {
-      if (actionVisits > maxVisitCount) {
-        bestAction    = actionPtr;
-        maxVisitCount = actionVisits;
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    if (statistics.m_classIds[i] == classId) {
+      if (statistics.m_visits[i] > maxVisitCount) {
+        bestAction    = statistics.m_actions[i];
+        maxVisitCount = statistics.m_visits[i];
       }
     }
   }
@@ -110,12 +110,13 @@ ActionPtr FinalSelectionMostTrusted::findBestAction(const Agent& agent, float ma
   ActionPtr bestAction{nullptr};
 
   // Loop over all actions of the action and return the one with the maximum performance criterion
-  for (const auto& [actionPtr, value] : agent.m_actionValues) {
-    float performanceIndicator =
-        calculatePerformanceIndicator(agent.m_actionVisits.at(actionPtr), value, maxCoopReward);
+  const auto& statistics = agent.m_actionStatistics;
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    float performanceIndicator = calculatePerformanceIndicator(
+        statistics.m_visits[i], statistics.m_values[i], maxCoopReward);
     if (maxValue < performanceIndicator) {
       maxValue   = performanceIndicator;
-      bestAction = actionPtr;
+      bestAction = statistics.m_actions[i];
     }
   }
   return bestAction;
@@ -138,13 +139,15 @@ ActionPtr FinalSelectionMostTrusted::findBestAction(const Agent& agent, float ma
 
   // Loop over all actions and determine the action within the given action class that maximizes the
   // performance criterion
-  for (const auto& [actionPtr, value] : agent.m_actionValues) {
-    if (actionPtr->m_actionClass == actionClass) {
-      float performanceIndicator =
-          calculatePerformanceIndicator(agent.m_actionVisits.at(actionPtr), value, maxCoopReward);
+  const auto& statistics = agent.m_actionStatistics;
+  const auto classId     = statistics.findClass(actionClass);
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    if (statistics.m_classIds[i] == classId) {
+      float performanceIndicator = calculatePerformanceIndicator(
+          statistics.m_visits[i], statistics.m_values[i], maxCoopReward);
       if (maxValue < performanceIndicator) {
         maxValue   = performanceIndicator;
-        bestAction = actionPtr;
+        bestAction = statistics.m_actions[i];
       }
     }
   }
@@ -165,12 +168,13 @@ ActionClass FinalSelectionMostTrusted::findBestActionClass(const Agent& agent,
   ActionClass bestActionClass{ActionClass::DO_NOTHING};
 
   // Loop over all action classes, calculate the criterion and store the best one for return
-  for (const auto& [actionClass, value] : agent.m_actionClassValues) {
+  const auto& statistics = agent.m_actionStatistics;
+  for (size_t i = 0; i < statistics.nClasses(); ++i) {
     float performanceIndicator = calculatePerformanceIndicator(
-        agent.m_actionClassVisits.at(actionClass), value, maxCoopReward);
+        statistics.m_classVisits[i], statistics.m_classValues[i], maxCoopReward);
     if (maxValue < performanceIndicator) {
       maxValue        = performanceIndicator;
-      bestActionClass = actionClass;
+      bestActionClass = statistics.m_classes[i];
     }
   }
   return bestActionClass;
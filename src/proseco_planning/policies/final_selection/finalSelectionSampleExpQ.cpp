@@ -64,23 +64,23 @@ ActionSet FinalSelectionSampleExpQ::getBestActionSet(const Node* const node) {
   for (const auto& agent : node->m_agents) {
     // Initialize placeholders
     std::vector<float> actionWeights;
-    ActionSet actions;
+    actionWeights.reserve(agent.m_actionStatistics.size());
+    const auto& actions = agent.m_actionStatistics.m_actions;
     /*
      * Calculate the weights for defining a categorical distribution over an
      * agent's actions. The weights for selecting each action are defined by applying the
      * softmax function over the agent's Q-values.
      */
-    for (const auto& [action, value] : agent.m_actionValues) {
+    for (const auto value : agent.m_actionStatistics.m_values) {
       actionWeights.push_back(calculateActionWeight(value));
-      actions.push_back(action);
     }
 
     auto [index, probability] = sampleActionFromWeights(actionWeights);
     auto bestAction           = actions[index];
     // Add the sampling probability to the chosen action
-    bestAction->m_selectionLikelihood = probability;
+    bestAction->annotation().m_selectionLikelihood = probability;
     // Add the unnormalized action selection weights to the chosen action
-    bestAction->m_selectionWeights = actionWeights;
+    bestAction->annotation().m_selectionWeights = actionWeights;
     // Append the action for agent i to the final action set
     m_bestActionSet.push_back(bestAction);
   }
@@ -41,7 +41,7 @@ ActionPtr Policy::getRandomAction(const Agent& agent) {
    * available_actions).
    * If it has not been visited yet, expand it first.
    */
-  if (agent.m_actionVisits.at(agent.m_availableActions[0]) <
+  if (agent.m_actionStatistics.visits(agent.m_availableActions[0]) <
       config::ComputeOptions::error_tolerance) {
     return agent.m_availableActions[0];
   }
@@ -61,16 +61,18 @@ bool Policy::isNodeTerminal(const Node* const node, unsigned int maxDepth) {
 }
 
 /**
- * @brief Sets a random action set based on the available actions of the node's agents.
+ * @brief Returns a random action set based on the available actions of the node's agents.
  *
- * @param node Pointer to the action set.
+ * @param node Pointer to the node.
+ * @return ActionSet The random action set.
  */
-void Policy::getRandomActionSet(Node* const node) {
-  node->m_actionSet.clear();
+ActionSet Policy::getRandomActionSet(const Node* const node) {
+  ActionSet actionSet;
   for (const auto& agent : node->m_agents) {
     // random selection
-    node->m_actionSet.push_back(getRandomAction(agent));
+    actionSet.push_back(getRandomAction(agent));
   }
+  return actionSet;
 }
 
 }  // namespace proseco_planning
@@ -1,14 +1,18 @@
 #include "proseco_planning/policies/selection/selectionUCTProgressiveWidening.h"
 
+#include <cmath>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "proseco_planning/action/action.h"
 #include "proseco_planning/agent/agent.h"
 #include "proseco_planning/config/computeOptions.h"
 #include "proseco_planning/config/configuration.h"
+#include "proseco_planning/math/mathlib.h"
 #include "proseco_planning/node.h"
 #include "proseco_planning/search_guide/searchGuide.h"
 
@@ -68,9 +72,9 @@ bool SelectionUCTProgressiveWidening::meetsMoveGroupingPWCriteria(const Node* co
   return !agent.m_isPredefined &&
          node->m_depth <
              cOpt().policy_options.policy_enhancements.progressive_widening.max_depth_pw &&
-         progressiveWidening(agent.m_actionClassCount.at(m_actionClassSet.at(agentIdx)),
+         progressiveWidening(agent.m_actionStatistics.classCount(m_actionClassSet.at(agentIdx)),
                              m_progressiveWideningCoefficient,
-                             agent.m_actionClassVisits.at(m_actionClassSet.at(agentIdx)),
+                             agent.m_actionStatistics.classVisits(m_actionClassSet.at(agentIdx)),
                              m_progressiveWideningExponent);
 }
 
@@ -99,16 +103,24 @@ bool SelectionUCTProgressiveWidening::meetsPWCriteria(const Node* const node) co
  */
 Node* SelectionUCTProgressiveWidening::selectNodeForExpansion(
     Node* node, ActionSet& actionSet, std::vector<std::vector<float> >& agentsRewards) {
-  while (!node->m_collision &&  // collision occurred -> invalid path
-         !node->m_invalid &&    // invalid state occurred -> invalid path
-         getBestNode(node) !=
-             nullptr)  // getBestNode returns nullPtr if the best action has not been taken yet
-  {
-    // if progressive widening is applied, continue with the expansion policy
-    if (checkForProgressiveWidening(node)) {
+  while (true) {
+    // the statistics and the children of a node are only accessed under its lock, since the search
+    // tree might be shared by multiple threads; at most one node is locked at a time
+    std::unique_lock<std::mutex> lock(node->m_mutex);
+    // collision occurred or invalid state occurred -> invalid path, the node is not expanded
+    if (node->m_collision || node->m_invalid) break;
+
+    // getBestNode returns nullPtr if the best action has not been taken yet
+    const auto bestNode = getBestNode(node);
+    if (bestNode == nullptr) {
+      // the actions are only resolved once the descent has ended
+      m_actionSet = node->actionSet(m_actionIds);
       break;
     }
 
+    // if progressive widening is applied, continue with the expansion policy
+    if (checkForProgressiveWidening(node)) break;
+
     // check for best action of already chosen ones,
     // not yet chosen ones lead to "infinite" UCT score
     // if infinite UCT score:
@@ -116,7 +128,13 @@ Node* SelectionUCTProgressiveWidening::selectNodeForExpansion(
     //  - expand them all
 
     // take the best action and descent down the tree
-    node = node->getChild(m_actionSet);
+    lock.unlock();
+    // a child that is still being expanded by another thread can only be entered once its actions
+    // have been executed
+    while (bestNode->m_pending.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    node = bestNode;
     // collect the reward from the taken action
     extractReward(node, agentsRewards);
   }
@@ -127,7 +145,7 @@ Node* SelectionUCTProgressiveWidening::selectNodeForExpansion(
 
 /**
  * @brief Return the "best" child node according to UCT. If this node doesn't exist, return
- * nullptr. It sets the member variable `m_actionSet` accordingly. Move Grouping is integrated in
+ * nullptr. It sets the member variable `m_actionIds` accordingly. Move Grouping is integrated in
  * here.
  *
  * @param node Pointer to the current node of the descent.
@@ -150,27 +168,22 @@ Node* SelectionUCTProgressiveWidening::getBestNode(const Node* const node) {
   // the action with the best score does not have to be already executed
   // => first (all/a lot of) permutations are explored
 
-  // already explored action
-  if (node->m_childMap.count(m_actionSet)) {
-    return node->m_childMap.at(m_actionSet).get();
-  }
-  // not tried permutation of the available actions
-  else {
-    return nullptr;
-  }
+  // already explored action or nullptr for a not tried permutation of the available actions
+  return node->m_childMap.find(m_actionIds);
 }
 
 /**
- * @brief Sets the best action set based on the UCT value.
+ * @brief Sets the best action ids based on the UCT value.
  *
  * @param node The node for which the best action set is determined.
  */
 void SelectionUCTProgressiveWidening::getBestActionUCT(const Node* const node) {
-  // Reset the former action set
-  m_actionSet.clear();
+  // Reset the former action ids
+  m_actionIds.clear();
   // Determine best action for each agent
   for (const auto& agent : node->m_agents) {
-    m_actionSet.push_back(agent.maxActionUCTAction());
+    m_actionIds.push_back(
+        static_cast<ActionId>(agent.m_actionStatistics.argmaxUCT(cOpt().uct_cp)));
   }
 }
 
@@ -189,39 +202,36 @@ void SelectionUCTProgressiveWidening::getBestActionClassUCT(const Node* const no
 }
 
 /**
- * @brief Sets the best action set based on the UCT value of the best action class set.
+ * @brief Sets the best action ids based on the UCT value of the best action class set.
  *
  * @param node The node for which the best action set is determined.
  * @param actionClassSet The action class set for which the best action set is determined.
  */
 void SelectionUCTProgressiveWidening::getBestActionUCT(
     const Node* const node, const std::vector<ActionClass>& actionClassSet) {
-  // Reset the former action set
-  m_actionSet.clear();
-
-  // determine best action within best action class
-  ActionPtr bestAction;
+  // Reset the former action ids
+  m_actionIds.clear();
 
   for (size_t i = 0; i < node->m_agents.size(); ++i) {
     // reset the best action and the best UCT score
-    bestAction    = nullptr;
+    ActionId bestActionId{0};
     float bestUCT = std::numeric_limits<float>::lowest();
 
-    for (const auto& [actionPtr, value] : node->m_agents[i].m_actionUCT) {
-      if (actionPtr->m_actionClass == m_actionClassSet[i]) {
-        if (value > bestUCT) {
-          bestUCT    = value;
-          bestAction = actionPtr;
+    // determine best action within best action class
+    const auto& statistics = node->m_agents[i].m_actionStatistics;
+    const auto classId     = statistics.findClass(actionClassSet[i]);
+    const float logTotalVisits{std::log(statistics.totalVisits())};
+    for (size_t actionIdx = 0; actionIdx < statistics.size(); ++actionIdx) {
+      if (statistics.m_classIds[actionIdx] == classId) {
+        const float uct{statistics.uctScore(actionIdx, cOpt().uct_cp, logTotalVisits)};
+        if (uct > bestUCT) {
+          bestUCT      = uct;
+          bestActionId = static_cast<ActionId>(actionIdx);
         }
       }
     }
 
-    m_actionSet.push_back(bestAction);
-
-    ///@todo check this
-    // assert(bestAction == nullptr && "best action is a nullptr");
-    // assert(bestAction->m_actionClass != m_actionClassSet[i] &&
-    //        "best action is not part of the best action class");
+    m_actionIds.push_back(bestActionId);
   }
 }
 
@@ -245,6 +255,8 @@ bool SelectionUCTProgressiveWidening::checkForProgressiveWidening(Node* const no
       // check if progressive widening within group is necessary
       auto& agent = node->m_agents[agentIdx];
       if (meetsMoveGroupingPWCriteria(node, agent, agentIdx)) {
+        // resolve the best actions before the first modification
+        if (!progressiveWidening) m_actionSet = node->actionSet(m_actionIds);
         // get action from best action class and manipulate the actionSet
         m_actionSet[agentIdx] = getGuidedActionForProgressiveWidening(agent, agentIdx);
         progressiveWidening   = true;
@@ -269,6 +281,7 @@ bool SelectionUCTProgressiveWidening::checkForProgressiveWidening(Node* const no
     // progressive widening only applied until depth 2
     // Decision on node level
     if (meetsPWCriteria(node)) {
+      m_actionSet = node->actionSet(m_actionIds);
       getActionSetForProgressiveWidening(node);
       setActionSetForProgressiveWidening(node);
       return true;
@@ -311,28 +324,33 @@ ActionPtr SelectionUCTProgressiveWidening::getGuidedActionForProgressiveWidening
     // sample within best action class
     auto& actionClass = m_actionSet.at(agentIdx)->m_actionClass;
     return agent.m_searchGuide->getBestActionInActionClassForPW(actionClass, *agent.m_actionSpace,
-                                                                agent.m_vehicle, agent.m_actionUCT);
+                                                                agent.m_vehicle,
+                                                                agent.m_actionStatistics);
   } else {
     // sample within action space
     return agent.m_searchGuide->getBestActionForPW(*agent.m_actionSpace, agent.m_vehicle,
-                                                   agent.m_actionUCT);
+                                                   agent.m_actionStatistics);
   }
 }
 
 /**
  * @brief Sets the action set for progressive widening. Adds the new actions to the action space of
- * the agents.
+ * the agents and updates the action ids accordingly.
  *
  * @param node The node to which the action set should be applied.
  */
 void SelectionUCTProgressiveWidening::setActionSetForProgressiveWidening(Node* const node) {
   for (size_t i = 0; i < node->m_agents.size(); ++i) {
+    auto& agent    = node->m_agents[i];
+    auto actionIdx = agent.m_actionStatistics.find(m_actionSet.at(i));
     // if one agent did NOT apply progressive widening this time no additional
     // action can be added to the maps since its already in there
-    if (!node->m_agents[i].m_actionVisits.contains(m_actionSet.at(i))) {
+    if (actionIdx == ActionStatistics::npos) {
       // add the generated action to the available actions of the agents
-      node->m_agents[i].addAvailableAction(m_actionSet.at(i));
+      agent.addAvailableAction(m_actionSet.at(i));
+      actionIdx = agent.m_actionStatistics.size() - 1;
     }
+    m_actionIds[i] = static_cast<ActionId>(actionIdx);
   }
 }
 }  // namespace proseco_planning
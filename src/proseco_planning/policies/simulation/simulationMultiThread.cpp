@@ -1,6 +1,5 @@
 #include "proseco_planning/policies/simulation/simulationMultiThread.h"
 
-#include <omp.h>
 #include <algorithm>
 #include <cstddef>
 #include <fstream>
@@ -13,6 +12,7 @@
 #include "proseco_planning/config/outputOptions.h"
 #include "proseco_planning/policies/policy.h"
 #include "proseco_planning/trajectory/trajectorygenerator.h"
+#include "proseco_planning/util/threadPool.h"
 
 namespace proseco_planning {
 
@@ -21,9 +21,11 @@ namespace proseco_planning {
  *
  * @param name The name that specifies the policy for the simulation.
  * @param agentsSize Integer that specifies the number of agents.
+ * @param threadPool The thread pool that runs the simulations.
  */
-SimulationMultiThread::SimulationMultiThread(const std::string& name, const int agentsSize)
-    : SimulationPolicy(name) {
+SimulationMultiThread::SimulationMultiThread(const std::string& name, const int agentsSize,
+                                             util::ThreadPool& threadPool)
+    : SimulationPolicy(name), m_threadPool(threadPool) {
   m_collisionChecker    = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
   m_trajectoryGenerator = TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
 
@@ -68,14 +70,14 @@ unsigned int SimulationMultiThread::runSimulation(Node* const node,
     // Initialize multiThreadAgentsRewards with 0
     resetRewardsVector();
 
-    omp_set_num_threads(cOpt().parallelization_options.n_simulationThreads);
-#pragma omp parallel for
-    for (size_t idx = 0; idx < cOpt().parallelization_options.n_simulationThreads; ++idx) {
-      // Simulation's node state
-      m_simulationNodes[idx] = std::make_unique<Node>(node);
-      simDepths[idx] =
-          simulate(m_simulationNodes[idx].get(), maxDepth, m_multiThreadAgentsRewards[idx]);
-    }
+    // the simulations run on the persistent thread pool, the calling thread takes part
+    m_threadPool.parallelFor(
+        cOpt().parallelization_options.n_simulationThreads, [&](const size_t idx) {
+          // Simulation's node state
+          m_simulationNodes[idx] = std::make_unique<Node>(node);
+          simDepths[idx] =
+              simulate(m_simulationNodes[idx].get(), maxDepth, m_multiThreadAgentsRewards[idx]);
+        });
 
     // Maximum depth reached during simulation
     maxSimDepth = *std::max_element(simDepths.begin(), simDepths.end());
@@ -19,13 +19,15 @@ namespace proseco_planning {
  *
  * @param name The name of the policy.
  * @param agentsSize The number of agents to be simulated.
+ * @param threadPool The thread pool that runs the simulations of the multi-threaded policy.
  * @return std::unique_ptr<SimulationPolicy> The pointer to the simulation policy.
  */
 std::unique_ptr<SimulationPolicy> SimulationPolicy::createPolicy(const std::string& name,
-                                                                 int agentsSize) {
+                                                                 int agentsSize,
+                                                                 util::ThreadPool& threadPool) {
   const auto& cOptions = cOpt();
   if (cOptions.parallelization_options.n_simulationThreads > 1) {
-    return std::make_unique<SimulationMultiThread>(name, agentsSize);
+    return std::make_unique<SimulationMultiThread>(name, agentsSize, threadPool);
   } else if (cOptions.parallelization_options.n_simulationThreads == 1) {
     return std::make_unique<SimulationSingleThread>(name);
   } else {
@@ -44,12 +46,12 @@ std::unique_ptr<SimulationPolicy> SimulationPolicy::createPolicy(const std::stri
  */
 unsigned int SimulationPolicy::simulate(Node* const simulationNode, unsigned int maxDepth,
                                         std::vector<std::vector<float> >& agentsRewards) {
+  ActionSet actionSet;
   while (!Policy::isNodeTerminal(simulationNode, maxDepth)) {
     // Determine actionSet for simulation
-    setSimulationActionSet(simulationNode);
+    setSimulationActionSet(simulationNode, actionSet);
     // Execute the action
-    simulationNode->executeActions(simulationNode->m_actionSet, *m_collisionChecker,
-                                   *m_trajectoryGenerator, false);
+    simulationNode->executeActions(actionSet, *m_collisionChecker, *m_trajectoryGenerator, false);
     // Increase the depth counter
     ++simulationNode->m_depth;
     // Extract the reward
@@ -62,24 +64,24 @@ unsigned int SimulationPolicy::simulate(Node* const simulationNode, unsigned int
  * @brief Determines the action set that is executed for the current step of the simulation.
  *
  * @param simulationNode Pointer to the simulation node.
+ * @param actionSet The action set to be determined (updated by reference).
  */
-void SimulationPolicy::setSimulationActionSet(Node* const simulationNode) const {
-  simulationNode->m_actionSet.clear();
+void SimulationPolicy::setSimulationActionSet(const Node* const simulationNode,
+                                              ActionSet& actionSet) const {
+  actionSet.clear();
   for (const auto& agent : simulationNode->m_agents) {
     if (agent.m_isPredefined) {
       // Predefined agent: Only drives straight if the ActionSpaceRectangle is used
-      simulationNode->m_actionSet.push_back(agent.m_actionSpace->getPredefinedActions()[0]);
+      actionSet.push_back(agent.m_actionSpace->getPredefinedActions()[0]);
     } else if (m_name == "moderate") {
       /*
        * Uses the agent's current position to determine actions according to semantic move groups.
        * One of these actions is then sampled and added.
        */
-      simulationNode->m_actionSet.push_back(
-          agent.m_actionSpace->sampleModerateAction(agent.m_vehicle));
+      actionSet.push_back(agent.m_actionSpace->sampleModerateAction(agent.m_vehicle));
     } else {
       // Nothing else specified: Sample an action uniformly at random and add it
-      simulationNode->m_actionSet.push_back(
-          agent.m_actionSpace->sampleRandomAction(agent.m_vehicle));
+      actionSet.push_back(agent.m_actionSpace->sampleRandomAction(agent.m_vehicle));
     }
   }
 }
@@ -1,8 +1,9 @@
 #include "proseco_planning/policies/updatePolicy.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
-#include <map>
+#include <mutex>
 #include <utility>
 
 #include "proseco_planning/agent/agent.h"
@@ -39,8 +40,11 @@ std::unique_ptr<UpdatePolicy> UpdatePolicy::createPolicy(const std::string& name
  */
 void UpdatePolicy::updateTree(Node* node, const std::vector<std::vector<float> >& agentsRewards,
                               unsigned int simulatedDepth) {
+  // the returns of all nodes along the tree path are calculated in a single pass
+  cumulativeDiscountedRewards(cOpt().discount_factor, simulatedDepth, agentsRewards, m_returns);
   while (node->m_parent != nullptr) {
-    updateNode(node, agentsRewards, simulatedDepth);
+    assert(simulatedDepth >= node->m_depth && "simulation depth is smaller than node depth");
+    updateNode(node, m_returns[node->m_depth - 1]);
     node = node->m_parent;
   }
   // because the root node is not included in the update (attention: the action
@@ -49,6 +53,33 @@ void UpdatePolicy::updateTree(Node* node, const std::vector<std::vector<float> >
   ++node->m_visits;
 }
 
+/**
+ * @brief Updates a search tree that is shared by multiple threads according to the simulation
+ * results, see `UpdatePolicy::updateTree`. Each step of the ascent locks the node and its parent,
+ * whose action statistics are updated.
+ *
+ * @param node Pointer to the node that the simulation was started from.
+ * @param agentsRewards Vector that contains for every step along the tree path another vector
+ * that stores the reward for each agent.
+ * @param simulatedDepth Depth of the simulation.
+ */
+void UpdatePolicy::updateSharedTree(Node* node,
+                                    const std::vector<std::vector<float> >& agentsRewards,
+                                    unsigned int simulatedDepth) {
+  // the returns of all nodes along the tree path are calculated in a single pass
+  cumulativeDiscountedRewards(cOpt().discount_factor, simulatedDepth, agentsRewards, m_returns);
+  while (node->m_parent != nullptr) {
+    assert(simulatedDepth >= node->m_depth && "simulation depth is smaller than node depth");
+    {
+      std::scoped_lock lock(node->m_mutex, node->m_parent->m_mutex);
+      updateNode(node, m_returns[node->m_depth - 1]);
+    }
+    node = node->m_parent;
+  }
+  std::lock_guard<std::mutex> lock(node->m_mutex);
+  ++node->m_visits;
+}
+
 /**
  * @brief Calculates the discounted reward.
  *
@@ -96,30 +127,40 @@ float UpdatePolicy::cumulativeDiscountedReward(const float discount_factor, cons
 
   return cumulative_discounted_reward;
 }
+
 /**
- * @brief Calculates the UCT value of all discrete actions for this agent.
+ * @brief Calculates the returns of a reward sequence for all agents and all depths at once.
+ * @details The returns are accumulated backwards from the simulation depth, using
+ * G_d = r_d + discount_factor * G_(d+1), hence every reward is only visited once.
  *
- * @param agent The agent.
+ * @param discount_factor The discount factor.
+ * @param simulation_depth The depth of the rewards vector where to end the calculation.
+ * @param rewards The rewards vector for all agents.
+ * @param returns The returns vector, `returns[d][agent_idx]` is equal to
+ * `cumulativeDiscountedReward(discount_factor, d + 1, simulation_depth, rewards, agent_idx)` for
+ * all d smaller than the simulation depth.
  */
-// calculate the UCT value of all actions for this agent
-void UpdatePolicy::updateActionUCT(Agent& agent) {
-  // find max and min of action values to normalize the exploitation term to [0,1]
-  float maxActionValue{agent.maxActionValue()};
-  float minActionValue{agent.minActionValue()};
-  float totalVisits{agent.cumulativeActionVisits()};
+void UpdatePolicy::cumulativeDiscountedRewards(const float discount_factor,
+                                               const int simulation_depth,
+                                               const std::vector<std::vector<float> >& rewards,
+                                               std::vector<std::vector<float> >& returns) {
+  assert(discount_factor <= 1.f && discount_factor > 0 &&
+         "discount factor not within bounds, (0,1]");
+  assert(simulation_depth <= static_cast<int>(rewards.size()) &&
+         "simulation depth exceeds the rewards vector");
 
-  for (auto visitsIter = agent.m_actionVisits.begin(), valuesIter = agent.m_actionValues.begin();
-       visitsIter != agent.m_actionVisits.end(); ++visitsIter, ++valuesIter) {
-    // If the visit count is less than 0.99 the action has not been visited yet, thus the UCT value
-    // of the action should be set to the initial UCT value.
-    if (visitsIter->second < 0.99 || maxActionValue == minActionValue) {
-      agent.m_actionUCT.at(visitsIter->first) = config::ComputeOptions::initial_uct;
+  returns.resize(rewards.size());
+  for (int depth = simulation_depth - 1; depth >= 0; --depth) {
+    const auto& stepRewards = rewards[depth];
+    auto& stepReturns       = returns[depth];
+    stepReturns.resize(stepRewards.size());
+    if (depth == simulation_depth - 1) {
+      std::copy(stepRewards.begin(), stepRewards.end(), stepReturns.begin());
     } else {
-      // the UCT score calculation is based on the total number of visits of the node
-      // this is equal to the sum of all visits of the agent's actions
-      agent.m_actionUCT.at(visitsIter->first) =
-          math::UCT(math::normalize(valuesIter->second, maxActionValue, minActionValue),
-                    visitsIter->second, totalVisits, cOpt().uct_cp);
+      const auto& nextReturns = returns[depth + 1];
+      for (size_t agent_idx = 0; agent_idx < stepRewards.size(); ++agent_idx) {
+        stepReturns[agent_idx] = stepRewards[agent_idx] + discount_factor * nextReturns[agent_idx];
+      }
     }
   }
 }
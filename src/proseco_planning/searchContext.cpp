@@ -0,0 +1,150 @@
+#include "proseco_planning/searchContext.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "proseco_planning/collision_checker/collisionChecker.h"
+#include "proseco_planning/config/computeOptions.h"
+#include "proseco_planning/config/configuration.h"
+#include "proseco_planning/node.h"
+#include "proseco_planning/trajectory/trajectorygenerator.h"
+
+namespace proseco_planning {
+
+/**
+ * @brief Constructs a search context with a thread pool that provides a worker for each thread of
+ * the root or tree parallelization and for each simulation thread, whichever is larger.
+ *
+ * @param parallelizationOptions The parallelization options.
+ */
+SearchContext::SearchContext(const config::ParallelizationOptions& parallelizationOptions)
+    : m_threadPool(std::max(parallelizationOptions.n_threads,
+                            parallelizationOptions.n_simulationThreads),
+                   parallelizationOptions.thread_pinning) {}
+
+/**
+ * @brief Destroys the search context after the pending release of search trees has finished.
+ *
+ */
+SearchContext::~SearchContext() { waitForRelease(); }
+
+/**
+ * @brief Continues the search tree of the previous planning step if possible: the child of the
+ * previous root that has been reached by the executed action set becomes the new root, provided
+ * that its predicted states match the observed states of `rootNode` within the configured
+ * tolerances. The observed states are kept, the statistics and the subtree of the child are moved
+ * to `rootNode`. Otherwise, `rootNode` is returned unchanged and the search starts from scratch.
+ * @details If only a fraction of the action set is executed, the observed states are compared with
+ * the states after the execution of that fraction. The descendants are rebuilt from the observed
+ * states in either case, see `Node::reuseSubtree`.
+ *
+ * @param rootNode The root node with the observed states.
+ * @param step The current planning step.
+ * @return std::unique_ptr<Node> The root node to start the search from.
+ */
+std::unique_ptr<Node> SearchContext::reuseTree(std::unique_ptr<Node> rootNode, int step) {
+  // take ownership so that the previous tree is released in any case
+  auto tree = std::move(m_previousTree);
+  if (tree == nullptr) return rootNode;
+
+  const auto child = tree->findChild(m_previousActionSet);
+  if (step == m_previousStep + 1 && child != nullptr) {
+    auto collisionChecker = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
+    auto trajectoryGenerator =
+        TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+
+    // the node with the predicted states
+    const Node* predictedNode{child};
+    std::unique_ptr<Node> fractionNode;
+    if (cOpt().policy_options.policy_enhancements.action_execution_fraction < 1.0f) {
+      fractionNode = std::make_unique<Node>(tree.get());
+      fractionNode->executeActions(m_previousActionSet, *collisionChecker, *trajectoryGenerator,
+                                   true);
+      predictedNode = fractionNode.get();
+    }
+
+    const auto& treeReuse = cOpt().policy_options.policy_enhancements.tree_reuse;
+    if (rootNode->matchesState(*predictedNode, treeReuse.max_position_drift,
+                               treeReuse.max_velocity_drift, treeReuse.max_acceleration_drift,
+                               treeReuse.max_heading_drift)) {
+      rootNode->reserveNodes(cOpt().n_iterations + tree->arenaSize(), cOpt().huge_pages);
+      rootNode->reuseSubtree(child, *collisionChecker, *trajectoryGenerator);
+    }
+  }
+
+  std::vector<std::unique_ptr<Node>> trees;
+  trees.push_back(std::move(tree));
+  releaseTrees(std::move(trees));
+  return rootNode;
+}
+
+/**
+ * @brief Retains the final search tree of the planning step so that it can be reused in the next
+ * planning step.
+ *
+ * @param root The root node of the final search tree.
+ * @param actionSet The action set that is going to be executed.
+ * @param step The current planning step.
+ */
+void SearchContext::retainTree(std::unique_ptr<Node> root, const ActionSet& actionSet, int step) {
+  m_previousTree      = std::move(root);
+  m_previousActionSet = actionSet;
+  m_previousStep      = step;
+}
+
+/**
+ * @brief Releases the retained search tree, e.g. at the end of a scenario.
+ *
+ */
+void SearchContext::resetTreeReuse() {
+  std::vector<std::unique_ptr<Node>> trees;
+  trees.push_back(std::move(m_previousTree));
+  releaseTrees(std::move(trees));
+  m_previousActionSet.clear();
+  m_previousStep = -1;
+}
+
+/**
+ * @brief Releases search trees in the background, so that the planner does not wait for the
+ * destruction of the nodes.
+ * @details The nodes own the states of their agents, so every node has to be destroyed
+ * individually. Handing the trees over as a whole to a separate task takes this off the planning
+ * step. At most one release is pending at a time, i.e. the release of the previous planning step is
+ * awaited first. The lookup statistics of the trajectory memos are collected before the release, so
+ * that the search itself does not aggregate them.
+ *
+ * @param roots The root nodes of the search trees.
+ */
+void SearchContext::releaseTrees(std::vector<std::unique_ptr<Node>> roots) {
+  waitForRelease();
+  m_release = std::async(std::launch::async, [this, trees = std::move(roots)]() mutable {
+    for (const auto& tree : trees) {
+      if (tree != nullptr) m_memoStatistics += tree->trajectoryMemoStatistics();
+    }
+    trees.clear();
+  });
+}
+
+/**
+ * @brief Returns the lookup statistics of the trajectory memos of all search trees that have been
+ * released so far, waiting for the pending release. A retained search tree is included once it is
+ * released, e.g. by `resetTreeReuse`.
+ *
+ * @return TrajectoryMemo::Statistics The summed lookup statistics.
+ */
+TrajectoryMemo::Statistics SearchContext::memoStatistics() {
+  waitForRelease();
+  return m_memoStatistics;
+}
+
+/**
+ * @brief Waits until the pending release of search trees has finished.
+ *
+ */
+void SearchContext::waitForRelease() {
+  if (m_release.valid()) {
+    m_release.get();
+  }
+}
+}  // namespace proseco_planning
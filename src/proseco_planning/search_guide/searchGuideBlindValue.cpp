@@ -8,6 +8,7 @@
 
 #include "proseco_planning/action/action.h"
 #include "proseco_planning/action/actionSpace.h"
+#include "proseco_planning/agent/actionStatistics.h"
 #include "proseco_planning/agent/agent.h"
 #include "proseco_planning/config/computeOptions.h"
 #include "proseco_planning/config/configuration.h"
@@ -32,22 +33,22 @@ SearchGuideBlindValue::SearchGuideBlindValue(const std::string& type) : SearchGu
  * @param actionClass The action class within to sample.
  * @param actionSpace The action space for the agent.
  * @param vehicle The current state of the vehicle.
- * @param actionUCT The UCT values for all available actions.
+ * @param actionStatistics The statistics (e.g. the UCT values) of all available actions.
  * @return ActionPtr To the best action for progressive widening.
  */
 ActionPtr SearchGuideBlindValue::getBestActionForPW(
     const ActionClass& actionClass, const ActionSpace& actionSpace, const Vehicle& vehicle,
-    const std::map<ActionPtr, float>& actionUCT) const {
+    const ActionStatistics& actionStatistics) const {
   // create random actions to evaluate the Blind Value
   auto randomActions{sampleRandomActions(actionClass, actionSpace, vehicle)};
 
   // Calculate the adaption coefficient based on the already explored actions
   // and the newly drawn actions
-  auto adaptionCoefficient{calculateAdaptionCoefficient(actionUCT, randomActions)};
+  auto adaptionCoefficient{calculateAdaptionCoefficient(actionStatistics, randomActions)};
 
   // Calculate Blind Values for each new action
   for (auto& [action, blindValue] : randomActions) {
-    blindValue = calculateBlindValue(adaptionCoefficient, action, actionUCT);
+    blindValue = calculateBlindValue(adaptionCoefficient, action, actionStatistics);
   }
 
   // Select action by blind value: action with max Blind Value
@@ -65,15 +66,15 @@ ActionPtr SearchGuideBlindValue::getBestActionForPW(
  */
 std::map<ActionPtr, float> SearchGuideBlindValue::sampleRandomActions(
     const ActionClass& actionClass, const ActionSpace& actionSpace, const Vehicle& vehicle) {
+  const auto nSamples = cOpt().policy_options.policy_enhancements.search_guide.n_samples;
+  // the samples are validated in batches, see `ActionSpace::sampleValidActions`
+  const auto actions =
+      actionClass == ActionClass::NONE
+          ? actionSpace.sampleRandomActions(vehicle, nSamples)
+          : actionSpace.sampleRandomActionsInActionClass(actionClass, vehicle, nSamples);
   std::map<ActionPtr, float> randomActions;
-  for (unsigned int i = 0; i < cOpt().policy_options.policy_enhancements.search_guide.n_samples;
-       ++i) {
-    if (actionClass == ActionClass::NONE) {
-      randomActions.insert(std::make_pair(actionSpace.sampleRandomAction(vehicle), 0.0f));
-    } else {
-      randomActions.insert(
-          std::make_pair(actionSpace.sampleRandomActionInActionClass(actionClass, vehicle), 0.0f));
-    }
+  for (const auto& action : actions) {
+    randomActions.insert(std::make_pair(action, 0.0f));
   }
   return randomActions;
 }
@@ -88,12 +89,14 @@ std::map<ActionPtr, float> SearchGuideBlindValue::sampleRandomActions(
  */
 float SearchGuideBlindValue::calculateBlindValue(
     const float adaptionCoefficient, const ActionPtr& newAction,
-    const std::map<ActionPtr, float>& exploredActions) {
+    const ActionStatistics& exploredActions) {
   std::vector<float> blindValues;
   blindValues.reserve(exploredActions.size());
 
-  for (const auto& [action, uctValue] : exploredActions) {
-    blindValues.push_back(uctValue + adaptionCoefficient * newAction->getDistance(action));
+  const auto& uctValues = exploredActions.uctScores(cOpt().uct_cp);
+  for (size_t i = 0; i < exploredActions.size(); ++i) {
+    const auto distance{newAction->getDistance(exploredActions.m_actions[i])};
+    blindValues.push_back(uctValues[i] + adaptionCoefficient * distance);
   }
 
   return *std::min_element(blindValues.begin(), blindValues.end());
@@ -103,14 +106,14 @@ float SearchGuideBlindValue::calculateBlindValue(
  * @brief Calculates the adaption coefficient based on the already explored actions
  * and the newly drawn actions.
  *
- * @param actionUCT The explored actions.
+ * @param actionStatistics The explored actions.
  * @param randomActions The randomly sampled actions.
  * @return float The adaption coefficient.
  */
 float SearchGuideBlindValue::calculateAdaptionCoefficient(
-    const std::map<ActionPtr, float>& actionUCT, const std::map<ActionPtr, float>& randomActions) {
+    const ActionStatistics& actionStatistics, const std::map<ActionPtr, float>& randomActions) {
   // Standard deviation of the UCT values of already explored actions
-  auto uctValues = math::mapValuesToVector(actionUCT);
+  const auto& uctValues = actionStatistics.uctScores(cOpt().uct_cp);
 
   // Standard deviation of the distance to the origin of random actions
   std::vector<float> distancesToOrigin;
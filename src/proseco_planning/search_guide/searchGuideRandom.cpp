@@ -10,12 +10,12 @@ class Vehicle;
  *
  * @param actionSpace The action space for the agent.
  * @param vehicle The current state of the vehicle.
- * @param actionUCT The UCT values for all available actions.
+ * @param actionStatistics The statistics (e.g. the UCT values) of all available actions.
  * @return ActionPtr To the best action for progressive widening.
  */
 ActionPtr SearchGuideRandom::getBestActionForPW(const ActionSpace& actionSpace,
                                                 const Vehicle& vehicle,
-                                                const std::map<ActionPtr, float>& actionUCT) const {
+                                                const ActionStatistics& actionStatistics) const {
   // sample whithin the entire action space
   return actionSpace.sampleRandomAction(vehicle);
 }
@@ -26,12 +26,12 @@ ActionPtr SearchGuideRandom::getBestActionForPW(const ActionSpace& actionSpace,
  * @param actionClass The action class within to sample.
  * @param actionSpace The action space for the agent.
  * @param vehicle The current state of the vehicle.
- * @param actionUCT The UCT values for all available actions.
+ * @param actionStatistics The statistics (e.g. the UCT values) of all available actions.
  * @return ActionPtr To the best action for progressive widening.
  */
 ActionPtr SearchGuideRandom::getBestActionInActionClassForPW(
     const ActionClass& actionClass, const ActionSpace& actionSpace, const Vehicle& vehicle,
-    const std::map<ActionPtr, float>& actionUCT) const {
+    const ActionStatistics& actionStatistics) const {
   // sample whithin the specified action class
   return actionSpace.sampleRandomActionInActionClass(actionClass, vehicle);
 }
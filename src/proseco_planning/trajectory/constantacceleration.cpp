@@ -1,7 +1,10 @@
 #include "proseco_planning/trajectory/constantacceleration.h"
 
 #include <cstddef>
+#include <eigen3/Eigen/Core>
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "proseco_planning/action/action.h"
 #include "proseco_planning/agent/vehicle.h"
@@ -113,6 +116,48 @@ Trajectory ConstantAcceleration::calculateTrajectory(const Vehicle& vehicle, con
   return trajectory;
 }
 
+/**
+ * @brief Calculates the trajectories of several actions from the same state of the vehicle.
+ * @details The sample times and their squares are shared by all actions, the samples of each
+ * action are evaluated as vector expressions, the state of the vehicle is not required.
+ *
+ * @param t0 The start time of the trajectories.
+ * @param boundaryConditions The boundary conditions of each trajectory.
+ * @param trajectories The trajectory of each set of boundary conditions, newly constructed or
+ * reset.
+ */
+void ConstantAcceleration::calculateTrajectories(
+    const Vehicle&, const float t0, const std::vector<BoundaryConditions>& boundaryConditions,
+    std::vector<Trajectory>& trajectories) const {
+  if (trajectories.empty()) return;
+
+  const auto nSteps{static_cast<Eigen::Index>(trajectories.front().m_nSteps)};
+  Eigen::ArrayXf time(nSteps);
+  for (Eigen::Index i = 0; i < nSteps; ++i) {
+    time(i) = t0 + i * cOpt().delta_t;
+  }
+  const Eigen::ArrayXf halfSquaredTime{0.5f * time.square()};
+  const auto samples = [nSteps](std::span<float> values) {
+    return Eigen::Map<Eigen::ArrayXf>(values.data(), nSteps);
+  };
+
+  for (std::size_t a = 0; a < trajectories.size(); ++a) {
+    auto& trajectory                         = trajectories[a];
+    const auto& [startS, startD, endS, endD] = boundaryConditions[a];
+    for (Eigen::Index i = 0; i < nSteps; ++i) {
+      trajectory.m_time[i] = time(i);
+    }
+    samples(trajectory.m_sPosition) =
+        halfSquaredTime * startS.acceleration + time * startS.velocity + startS.position;
+    samples(trajectory.m_dPosition) =
+        halfSquaredTime * startD.acceleration + time * startD.velocity + startD.position;
+    samples(trajectory.m_sVelocity)     = time * startS.acceleration + startS.velocity;
+    samples(trajectory.m_dVelocity)     = time * startD.acceleration + startD.velocity;
+    samples(trajectory.m_sAcceleration) = startS.acceleration;
+    samples(trajectory.m_dAcceleration) = startD.acceleration;
+  }
+}
+
 /**
  * @brief Updates the final state of the trajectory for updating the vehicle's state.
  *
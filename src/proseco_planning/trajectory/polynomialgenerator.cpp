@@ -4,6 +4,10 @@
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/LU>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
 
 #include "proseco_planning/action/action.h"
 #include "proseco_planning/agent/vehicle.h"
@@ -12,8 +16,123 @@
 #include "proseco_planning/trajectory/trajectory.h"
 namespace proseco_planning {
 
+/**
+ * @brief Constructs the basis of the fifth order polynomials for a given duration.
+ *
+ * @param duration The duration of the polynomials.
+ */
+QuinticBasis::QuinticBasis(const float duration)
+    : m_duration(duration), m_accelerationGram(accelerationGramMatrix(0.0f, duration)) {
+  const float T{duration};
+  const float T2{T * T};
+  const float T3{T2 * T};
+  const float T4{T3 * T};
+  const float T5{T4 * T};
+  // inverse of the end constraint rows of t^3, t^4 and t^5 for the start time zero
+  m_endToCoefficients << 10.0f / T3, -4.0f / T2, 0.5f / T,  //
+      -15.0f / T4, 7.0f / T3, -1.0f / T2,                   //
+      6.0f / T5, -3.0f / T4, 0.5f / T3;
+}
+
+/**
+ * @brief Calculates the coefficients of the fifth order polynomial for a given set of constraints.
+ *
+ * @param constraints The start as well as end constraints for position, velocity and acceleration.
+ * @return Eigen::Matrix<float, 1, 6> The coefficients of the fifth order polynomial.
+ */
+Eigen::Matrix<float, 1, 6> QuinticBasis::coefficients(
+    const Eigen::Matrix<float, 1, 6>& constraints) const {
+  const float T{m_duration};
+  Eigen::Matrix<float, 1, 6> coeff;
+  coeff(0) = constraints(0);
+  coeff(1) = constraints(1);
+  coeff(2) = constraints(2) / 2;
+
+  // the residuals of the end constraints w.r.t. the polynomial of the start constraints
+  const Eigen::Vector3f residuals{constraints(3) - (coeff(0) + (coeff(1) + coeff(2) * T) * T),
+                                  constraints(4) - (coeff(1) + 2 * coeff(2) * T),
+                                  constraints(5) - 2 * coeff(2)};
+  coeff.tail<3>() = (m_endToCoefficients * residuals).transpose();
+  return coeff;
+}
+
+/**
+ * @brief Calculates the integral of the squared acceleration over the duration of the basis.
+ *
+ * @param coeff The coefficients of the fifth order polynomial.
+ * @return float The integral of the squared acceleration.
+ */
+float QuinticBasis::squaredAccelerationIntegral(const Eigen::Matrix<float, 1, 6>& coeff) const {
+  const Eigen::Vector4f c{coeff.tail<4>().transpose()};
+  return c.dot(m_accelerationGram * c);
+}
+
+/**
+ * @brief Calculates the Gram matrix of the acceleration basis {2, 6t, 12t^2, 20t^3} of the fifth
+ * order polynomial, i.e. the integral of the squared acceleration is c^T G c with c being the last
+ * four coefficients.
+ *
+ * @param t_0 The start time of the integral.
+ * @param t_1 The end time of the integral.
+ * @return Eigen::Matrix4f The Gram matrix.
+ */
+Eigen::Matrix4f QuinticBasis::accelerationGramMatrix(const float t_0, const float t_1) {
+  constexpr float weights[4]{2.0f, 6.0f, 12.0f, 20.0f};
+  // the integrals of t^(n-1), i.e. (t_1^n - t_0^n) / n
+  float integrals[8]{};
+  float power0{1.0f};
+  float power1{1.0f};
+  for (int n = 1; n < 8; ++n) {
+    power0 *= t_0;
+    power1 *= t_1;
+    integrals[n] = (power1 - power0) / n;
+  }
+  Eigen::Matrix4f gram;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      gram(i, j) = weights[i] * weights[j] * integrals[i + j + 1];
+    }
+  }
+  return gram;
+}
+
+/**
+ * @brief Constructs the basis of the fifth order polynomials at the sample times of a trajectory.
+ *
+ * @param t0 The start time of the trajectory.
+ * @param deltaT The time between two samples.
+ * @param nSteps The number of samples.
+ */
+SampleBasis::SampleBasis(const float t0, const float deltaT, const std::size_t nSteps)
+    : m_t0(t0),
+      m_deltaT(deltaT),
+      m_nSteps(nSteps),
+      m_position(6, nSteps),
+      m_velocity(6, nSteps),
+      m_acceleration(6, nSteps) {
+  for (std::size_t i = 0; i < nSteps; ++i) {
+    const float t{t0 + i * deltaT};
+    m_position.col(i) << 1, t, t * t, t * t * t, t * t * t * t, t * t * t * t * t;
+    m_velocity.col(i) << 0, 1, 2 * t, 3 * t * t, 4 * t * t * t, 5 * t * t * t * t;
+    m_acceleration.col(i) << 0, 0, 2, 6 * t, 12 * t * t, 20 * t * t * t;
+  }
+}
+
+/**
+ * @brief Constructs a new Polynomial Generator object.
+ *
+ * @param name The method for trajectory generation.
+ */
+PolynomialGenerator::PolynomialGenerator(const std::string& name)
+    : TrajectoryGenerator(name),
+      m_basis(cOpt().action_duration),
+      m_sampleBasis(0.0f, cOpt().delta_t, Trajectory(0.0f, 0.0f).m_nSteps) {}
+
 /**
  * @brief Calculates the coefficients of the fifth order polynomial for a given set of constraints.
+ * @details Uses the precomputed basis if the trajectory starts at zero and lasts for the duration
+ * of an action. Other durations compute their basis on the fly, other start times solve the
+ * constraints.
  *
  * @param constraints The start as well as end constraints for position, velocity and acceleration.
  * @param t_0 The start time of the trajectory.
@@ -22,6 +141,26 @@ namespace proseco_planning {
  */
 Eigen::Matrix<float, 1, 6> PolynomialGenerator::calculate_coefficients(
     const Eigen::Matrix<float, 1, 6>& constraints, const float t_0, const float t_1) const {
+  if (t_0 != 0.0f) {
+    return solve_coefficients(constraints, t_0, t_1);
+  } else if (t_1 == m_basis.m_duration) {
+    return m_basis.coefficients(constraints);
+  } else {
+    return QuinticBasis(t_1).coefficients(constraints);
+  }
+}
+
+/**
+ * @brief Calculates the coefficients of the fifth order polynomial for a given set of constraints
+ * by solving the linear system of the constraints.
+ *
+ * @param constraints The start as well as end constraints for position, velocity and acceleration.
+ * @param t_0 The start time of the trajectory.
+ * @param t_1 The end time of the trajectory.
+ * @return Eigen::Matrix<float, 1, 6> The coefficients of the fifth order polynomial.
+ */
+Eigen::Matrix<float, 1, 6> PolynomialGenerator::solve_coefficients(
+    const Eigen::Matrix<float, 1, 6>& constraints, const float t_0, const float t_1) const {
   Eigen::Matrix<float, 6, 6> M;
 
   // t_0 x - position
@@ -169,68 +308,6 @@ float PolynomialGenerator::calculate_heading(const Trajectory& trajectory, const
   }
 }
 
-/**
- * @brief Calculates the curvature of the trajectory using the combination of the polynomials in the
- * longitudinal and lateral direction.
- *
- * @param trajectory The trajectory for which the curvature should be calculated.
- * @param i The index at which the curvature should be calculated.
- * @return float The curvature at the given index.
- */
-float PolynomialGenerator::calculate_curvature(const Trajectory& trajectory, const size_t i) const {
-  // https://en.wikipedia.org/wiki/Curvature
-  // catch the case of velocities approaching 0
-  if (std::abs(trajectory.m_dVelocity[i]) < 0.0001f &&
-      std::abs(trajectory.m_sVelocity[i]) < 0.0001f) {
-    return 0;
-  } else {
-    return (trajectory.m_dAcceleration[i] * trajectory.m_sVelocity[i] -
-            trajectory.m_dVelocity[i] * trajectory.m_sAcceleration[i]) /
-           std::pow(trajectory.m_dVelocity[i] * trajectory.m_dVelocity[i] +
-                        trajectory.m_sVelocity[i] * trajectory.m_sVelocity[i],
-                    1.5f);
-  }
-}
-
-/**
- * @brief Calculates the steering angle of the trajectory using the combination of the polynomials
- * in the longitudinal and lateral direction.
- *
- * @param trajectory The trajectory for which the steering angle should be calculated.
- * @param i The index at which the steering angle should be calculated.
- * @return float The steering angle at the given index.
- */
-float PolynomialGenerator::calculate_steering_angle(const Trajectory& trajectory, const size_t i,
-                                                    const Vehicle& vehicle) const {
-  return std::atan2(vehicle.m_wheelBase * trajectory.m_curvature[i], 1.0f);
-}
-
-/**
- * @brief Calculates the total acceleration of the trajectory using the combination of the
- * polynomials in the longitudinal and lateral direction.
- *
- * @param trajectory The trajectory for which the total acceleration should be calculated.
- * @param i The index at which the total acceleration should be calculated.
- * @return float The total acceleration at the given index.
- */
-float PolynomialGenerator::calculate_total_acceleration(const Trajectory& trajectory,
-                                                        const size_t i) const {
-  return math::magnitude(trajectory.m_sAcceleration[i], trajectory.m_dAcceleration[i]);
-}
-
-/**
- * @brief Calculates the total velocity of the trajectory using the combination of the polynomials
- * in the longitudinal and lateral direction.
- *
- * @param trajectory The trajectory for which the total velocity should be calculated.
- * @param i The index at which the total velocity should be calculated.
- * @return float The total velocity at the given index.
- */
-float PolynomialGenerator::calculate_total_velocity(const Trajectory& trajectory,
-                                                    const size_t i) const {
-  return math::magnitude(trajectory.m_sVelocity[i], trajectory.m_dVelocity[i]);
-}
-
 /**
  * @brief Calculates the integral of the squared acceleration of the fifth order polynomial.
  *
@@ -245,17 +322,25 @@ float PolynomialGenerator::squared_acceleration_integral(const BoundaryCondition
                                                          const float t_0, const float t_1) const {
   auto constraints = boundaryConditionsToEigenMatrix(start, end);
   auto coeff       = calculate_coefficients(constraints, t_0, t_1);
+  return squared_acceleration_integral(coeff, t_0, t_1);
+}
 
-  return 400.0f / 7 * std::pow(coeff(5), 2) * (-std::pow(t_0, 7) + std::pow(t_1, 7)) +
-         80 * coeff(4) * coeff(5) * (-std::pow(t_0, 6) + std::pow(t_1, 6)) +
-         (0.240e3 * coeff(3) * coeff(5) + 144 * std::pow(coeff(4), 2)) *
-             (-t_0 * t_0 * t_0 * t_0 * t_0 + t_1 * t_1 * t_1 * t_1 * t_1) / 5 +
-         (80 * coeff(2) * coeff(5) + 144 * coeff(3) * coeff(4)) *
-             (-t_0 * t_0 * t_0 * t_0 + t_1 * t_1 * t_1 * t_1) / 4 +
-         (48 * coeff(2) * coeff(4) + 36 * std::pow(coeff(3), 2)) *
-             (-t_0 * t_0 * t_0 + t_1 * t_1 * t_1) / 3 +
-         12 * coeff(2) * coeff(3) * (-t_0 * t_0 + t_1 * t_1) +
-         4 * std::pow(coeff(2), 2) * (-t_0 + t_1);
+/**
+ * @brief Calculates the integral of the squared acceleration of the fifth order polynomial with
+ * known coefficients.
+ *
+ * @param coeff The coefficients of the fifth order polynomial.
+ * @param t_0 The start time to calculate the integral.
+ * @param t_1 The end time to calculate the integral.
+ * @return float The integral of the squared acceleration.
+ */
+float PolynomialGenerator::squared_acceleration_integral(const Eigen::Matrix<float, 1, 6>& coeff,
+                                                         const float t_0, const float t_1) const {
+  if (t_0 == 0.0f && t_1 == m_basis.m_duration) {
+    return m_basis.squaredAccelerationIntegral(coeff);
+  }
+  const Eigen::Vector4f c{coeff.tail<4>().transpose()};
+  return c.dot(QuinticBasis::accelerationGramMatrix(t_0, t_1) * c);
 }
 
 /**
@@ -330,6 +415,13 @@ Trajectory PolynomialGenerator::calculateTrajectory(const Vehicle& vehicle, cons
   auto constraints_d = boundaryConditionsToEigenMatrix(startD, endD);
   auto coeff_d       = calculate_coefficients(constraints_d, trajectory.m_t0, trajectory.m_t1);
 
+  // the integrals of the complete trajectory reuse its coefficients, see
+  // calculateCumulativeAcceleration
+  trajectory.m_cumSquaredAccelerationLon =
+      squared_acceleration_integral(coeff_s, trajectory.m_t0, trajectory.m_t1);
+  trajectory.m_cumSquaredAccelerationLat =
+      squared_acceleration_integral(coeff_d, trajectory.m_t0, trajectory.m_t1);
+
   for (size_t i = 0; i < trajectory.m_nSteps; ++i) {
     const auto t = t0 + i * cOpt().delta_t;
 
@@ -340,15 +432,118 @@ Trajectory PolynomialGenerator::calculateTrajectory(const Vehicle& vehicle, cons
     trajectory.m_dVelocity[i]         = calculate_velocity(coeff_d, t);
     trajectory.m_sAcceleration[i]     = calculate_acceleration(coeff_s, t);
     trajectory.m_dAcceleration[i]     = calculate_acceleration(coeff_d, t);
-    trajectory.m_heading[i]           = calculate_heading(trajectory, i, vehicle);
-    trajectory.m_curvature[i]         = calculate_curvature(trajectory, i);
-    trajectory.m_steeringAngle[i]     = calculate_steering_angle(trajectory, i, vehicle);
-    trajectory.m_totalVelocity[i]     = calculate_total_velocity(trajectory, i);
-    trajectory.m_totalAcceleration[i] = calculate_total_acceleration(trajectory, i);
+  }
+  calculate_vehicle_states(trajectory, vehicle);
+  return trajectory;
+}
+
+/**
+ * @brief Calculates the trajectories of several actions from the same state of the vehicle.
+ * @details The samples of the polynomials are evaluated for all actions at once, as the product of
+ * the coefficients of all actions and the basis at the sample times, which is shared by all
+ * actions.
+ *
+ * @param vehicle The current state of the vehicle.
+ * @param t0 The start time of the trajectories.
+ * @param boundaryConditions The boundary conditions of each trajectory.
+ * @param trajectories The trajectory of each set of boundary conditions, newly constructed or
+ * reset.
+ */
+void PolynomialGenerator::calculateTrajectories(
+    const Vehicle& vehicle, const float t0,
+    const std::vector<BoundaryConditions>& boundaryConditions,
+    std::vector<Trajectory>& trajectories) const {
+  if (trajectories.empty()) return;
+
+  const auto nSteps{trajectories.front().m_nSteps};
+  const float t1{trajectories.front().m_t1};
+
+  std::optional<SampleBasis> sampleBasis;
+  if (t0 != m_sampleBasis.m_t0 || nSteps != m_sampleBasis.m_nSteps ||
+      cOpt().delta_t != m_sampleBasis.m_deltaT) {
+    sampleBasis.emplace(t0, cOpt().delta_t, nSteps);
+  }
+  const auto& basis = sampleBasis ? *sampleBasis : m_sampleBasis;
+
+  // the coefficients of all actions, longitudinal in the even and lateral in the odd rows
+  Eigen::Matrix<float, Eigen::Dynamic, 6> coefficients(2 * trajectories.size(), 6);
+  for (std::size_t a = 0; a < trajectories.size(); ++a) {
+    const auto& [startS, startD, endS, endD] = boundaryConditions[a];
+    coefficients.row(2 * a) =
+        calculate_coefficients(boundaryConditionsToEigenMatrix(startS, endS), t0, t1);
+    coefficients.row(2 * a + 1) =
+        calculate_coefficients(boundaryConditionsToEigenMatrix(startD, endD), t0, t1);
+  }
+
+  using Samples = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const Samples positions{coefficients.lazyProduct(basis.m_position)};
+  const Samples velocities{coefficients.lazyProduct(basis.m_velocity)};
+  const Samples accelerations{coefficients.lazyProduct(basis.m_acceleration)};
+  const auto samples = [nSteps](std::span<float> values) {
+    return Eigen::Map<Eigen::RowVectorXf>(values.data(), static_cast<Eigen::Index>(nSteps));
+  };
+
+  for (std::size_t a = 0; a < trajectories.size(); ++a) {
+    auto& trajectory = trajectories[a];
+    const auto s     = static_cast<Eigen::Index>(2 * a);
+    const auto d     = s + 1;
+    for (size_t i = 0; i < nSteps; ++i) {
+      trajectory.m_time[i] = t0 + i * cOpt().delta_t;
+    }
+    samples(trajectory.m_sPosition)     = positions.row(s);
+    samples(trajectory.m_dPosition)     = positions.row(d);
+    samples(trajectory.m_sVelocity)     = velocities.row(s);
+    samples(trajectory.m_dVelocity)     = velocities.row(d);
+    samples(trajectory.m_sAcceleration) = accelerations.row(s);
+    samples(trajectory.m_dAcceleration) = accelerations.row(d);
+
+    trajectory.m_cumSquaredAccelerationLon =
+        squared_acceleration_integral(coefficients.row(s), t0, t1);
+    trajectory.m_cumSquaredAccelerationLat =
+        squared_acceleration_integral(coefficients.row(d), t0, t1);
+    calculate_vehicle_states(trajectory, vehicle);
+  }
+}
+
+/**
+ * @brief Calculates the heading, curvature, steering angle, total velocity and total acceleration
+ * from the sampled polynomials and checks the validity of the trajectory.
+ * @details Except for the heading, the states are evaluated as vector expressions over all steps.
+ *
+ * @param trajectory The trajectory with the sampled polynomials.
+ * @param vehicle The current state of the vehicle.
+ */
+void PolynomialGenerator::calculate_vehicle_states(Trajectory& trajectory,
+                                                   const Vehicle& vehicle) const {
+  const auto n{static_cast<Eigen::Index>(trajectory.m_nSteps)};
+  const auto samples = [n](std::span<float> values) {
+    return Eigen::Map<Eigen::ArrayXf>(values.data(), n);
+  };
+  const auto sVelocity{samples(trajectory.m_sVelocity)};
+  const auto dVelocity{samples(trajectory.m_dVelocity)};
+  const auto sAcceleration{samples(trajectory.m_sAcceleration)};
+  const auto dAcceleration{samples(trajectory.m_dAcceleration)};
+
+  const Eigen::ArrayXf squaredVelocity{sVelocity.square() + dVelocity.square()};
+  samples(trajectory.m_totalVelocity) = squaredVelocity.sqrt();
+  samples(trajectory.m_totalAcceleration) =
+      (sAcceleration.square() + dAcceleration.square()).sqrt();
+
+  // https://en.wikipedia.org/wiki/Curvature
+  // catch the case of velocities approaching 0
+  samples(trajectory.m_curvature) =
+      (sVelocity.abs() < 0.0001f && dVelocity.abs() < 0.0001f)
+          .select(0.0f, (dAcceleration * sVelocity - dVelocity * sAcceleration) /
+                            (squaredVelocity * samples(trajectory.m_totalVelocity)));
+  samples(trajectory.m_steeringAngle) =
+      (vehicle.m_wheelBase * samples(trajectory.m_curvature)).atan();
+
+  // the heading falls back to the previous heading, thus it is calculated step by step
+  for (size_t i = 0; i < trajectory.m_nSteps; ++i) {
+    trajectory.m_heading[i] = calculate_heading(trajectory, i, vehicle);
   }
   trajectory.m_invalidAction = !trajectory.isValidAction(vehicle);
   trajectory.m_invalidState  = !trajectory.isValidState(vehicle);
-  return trajectory;
 }
 
 /**
@@ -385,6 +580,8 @@ void PolynomialGenerator::calculateCumulativeAcceleration(Trajectory& trajectory
   // don't modify the "global" end constraint! the trajectory is calculated for a
   // length of DeltaT
   const auto t1 = Trajectory::getCurrentFraction() * trajectory.m_t1;
+  // the integrals of the complete trajectory have already been calculated in calculateTrajectory
+  if (t1 == trajectory.m_t1) return;
 
   trajectory.m_cumSquaredAccelerationLon =
       squared_acceleration_integral(startS, endS, trajectory.m_t0, t1);
@@ -1,7 +1,9 @@
 #include "proseco_planning/trajectory/trajectory.h"
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <utility>
 
 #include "proseco_planning/agent/vehicle.h"
 #include "proseco_planning/config/computeOptions.h"
@@ -20,29 +22,150 @@ bool Trajectory::useActionFraction{false};
  * @param t0 The start time of the trajectory.
  * @param initialHeading The initial heading of the vehicle.
  */
-Trajectory::Trajectory(const float t0, const float initialHeading) {
+Trajectory::Trajectory(const float t0, const float initialHeading) { reset(t0, initialHeading); }
+
+/**
+ * @brief Constructs a copy of a trajectory, which only allocates if the trajectory has more than
+ * `inlineSteps` steps.
+ *
+ * @param other The trajectory to copy.
+ */
+Trajectory::Trajectory(const Trajectory& other) { copyFrom(other); }
+
+/**
+ * @brief Constructs a trajectory from another one, taking over its heap storage if it has any.
+ *
+ * @param other The trajectory to move, empty afterwards.
+ */
+Trajectory::Trajectory(Trajectory&& other) noexcept { *this = std::move(other); }
+
+/**
+ * @brief Copies a trajectory, reusing the heap storage of this trajectory if it is large enough.
+ *
+ * @param other The trajectory to copy.
+ * @return Trajectory& This trajectory.
+ */
+Trajectory& Trajectory::operator=(const Trajectory& other) {
+  if (this != &other) copyFrom(other);
+  return *this;
+}
+
+/**
+ * @brief Moves a trajectory, taking over its heap storage if it has any.
+ *
+ * @param other The trajectory to move, empty afterwards.
+ * @return Trajectory& This trajectory.
+ */
+Trajectory& Trajectory::operator=(Trajectory&& other) noexcept {
+  if (this == &other) return *this;
+  if (other.m_nSteps > inlineSteps) {
+    m_heapValues = std::move(other.m_heapValues);
+    m_heapLanes  = std::move(other.m_heapLanes);
+    m_heapSteps  = std::exchange(other.m_heapSteps, 0);
+  }
+  copyFrom(other);
+  other.allocate(0);
+  return *this;
+}
+
+/**
+ * @brief Resets the trajectory to the state of a newly constructed one, keeping its heap storage.
+ *
+ * @param t0 The start time of the trajectory.
+ * @param initialHeading The initial heading of the vehicle.
+ */
+void Trajectory::reset(const float t0, const float initialHeading) {
   // initialize characteristic values
-  m_t0     = t0;
-  m_t1     = t0 + cOpt().action_duration;
-  m_t0_2   = m_t0 * m_t0;
-  m_t1_2   = m_t1 * m_t1;
-  m_nSteps = (m_t1 - m_t0) / cOpt().delta_t + 1;
-
-  // initialize vectors
-  m_time.reserve(m_nSteps);
-
-  m_sPosition.resize(m_nSteps, 0);
-  m_dPosition.resize(m_nSteps, 0);
-  m_sVelocity.resize(m_nSteps, 0);
-  m_dVelocity.resize(m_nSteps, 0);
-  m_sAcceleration.resize(m_nSteps, 0);
-  m_dAcceleration.resize(m_nSteps, 0);
-  m_lane.resize(m_nSteps, 0);
-  m_heading.resize(m_nSteps, 0);
-  m_steeringAngle.resize(m_nSteps, 0);
-  m_curvature.resize(m_nSteps, 0);
-  m_totalVelocity.resize(m_nSteps, 0);
-  m_totalAcceleration.resize(m_nSteps, 0);
+  m_t0   = t0;
+  m_t1   = t0 + cOpt().action_duration;
+  m_t0_2 = m_t0 * m_t0;
+  m_t1_2 = m_t1 * m_t1;
+
+  // initialize the values at each time step
+  const size_t nSteps = (m_t1 - m_t0) / cOpt().delta_t + 1;
+  allocate(nSteps);
+  std::fill_n(m_time.data(), nFloatFields * m_nSteps, 0.0f);
+  std::fill(m_lane.begin(), m_lane.end(), 0);
+  m_finalState.fill(0.0f);
+
+  m_averageVelocity             = 0.0f;
+  m_averageAbsoluteAcceleration = 0.0f;
+  m_cumSquaredAccelerationLon   = 0.0f;
+  m_cumSquaredAccelerationLat   = 0.0f;
+  m_laneChange                  = 0;
+  m_invalidAction               = false;
+  m_invalidState                = false;
+}
+
+/**
+ * @brief Sets the number of steps and binds the fields to the storage, which is allocated on the
+ * heap if the steps exceed the inline storage and the current heap storage.
+ * @note The values of the fields are not initialized.
+ *
+ * @param nSteps The number of steps.
+ */
+void Trajectory::allocate(const std::size_t nSteps) {
+  m_nSteps = nSteps;
+  if (nSteps > inlineSteps && nSteps > m_heapSteps) {
+    m_heapValues = std::make_unique_for_overwrite<float[]>(nFloatFields * nSteps);
+    m_heapLanes  = std::make_unique_for_overwrite<int[]>(nSteps);
+    m_heapSteps  = nSteps;
+  }
+  bindFields();
+}
+
+/**
+ * @brief Copies all members of a trajectory, except for its storage.
+ *
+ * @param other The trajectory to copy.
+ */
+void Trajectory::copyFrom(const Trajectory& other) {
+  m_t0   = other.m_t0;
+  m_t1   = other.m_t1;
+  m_t0_2 = other.m_t0_2;
+  m_t1_2 = other.m_t1_2;
+
+  allocate(other.m_nSteps);
+  // the storage may have been taken over from the other trajectory, see the move assignment
+  if (m_time.data() != other.m_time.data()) {
+    std::copy_n(other.m_time.data(), nFloatFields * m_nSteps, m_time.data());
+    std::copy_n(other.m_lane.data(), m_nSteps, m_lane.data());
+  }
+  m_finalState = other.m_finalState;
+
+  m_averageVelocity             = other.m_averageVelocity;
+  m_averageAbsoluteAcceleration = other.m_averageAbsoluteAcceleration;
+  m_cumSquaredAccelerationLon   = other.m_cumSquaredAccelerationLon;
+  m_cumSquaredAccelerationLat   = other.m_cumSquaredAccelerationLat;
+  m_laneChange                  = other.m_laneChange;
+  m_invalidAction               = other.m_invalidAction;
+  m_invalidState                = other.m_invalidState;
+}
+
+/**
+ * @brief Binds the spans of the fields to consecutive ranges of the inline or the heap storage.
+ */
+void Trajectory::bindFields() {
+  const bool onHeap{m_nSteps > inlineSteps};
+  float* values{onHeap ? m_heapValues.get() : m_inlineValues.data()};
+  const auto field = [&values, this]() {
+    const std::span<float> field(values, m_nSteps);
+    values += m_nSteps;
+    return field;
+  };
+  m_time              = field();
+  m_sPosition         = field();
+  m_dPosition         = field();
+  m_sVelocity         = field();
+  m_dVelocity         = field();
+  m_sAcceleration     = field();
+  m_dAcceleration     = field();
+  m_curvature         = field();
+  m_heading           = field();
+  m_steeringAngle     = field();
+  m_totalVelocity     = field();
+  m_totalAcceleration = field();
+  m_lane = std::span<int>(onHeap ? m_heapLanes.get() : m_inlineLanes.data(), m_nSteps);
 }
 
 /**
@@ -100,18 +223,16 @@ void Trajectory::determineLaneChange() { m_laneChange = m_lane.back() - m_lane.f
  * @brief Calculates the average speed of the trajectory.
  */
 void Trajectory::calculateAverageSpeed() {
-  const auto fractionVector = math::getSubvectorFromVector(m_totalVelocity, 0, getFractionIndex());
-  m_averageVelocity =
-      std::accumulate(fractionVector.begin(), fractionVector.end(), 0.0f) / fractionVector.size();
+  const auto fraction = m_totalVelocity.first(getFractionIndex() + 1);
+  m_averageVelocity   = std::accumulate(fraction.begin(), fraction.end(), 0.0f) / fraction.size();
 }
 
 /**
  * @brief Calculates the average absolute acceleration of the trajectory.
  */
 void Trajectory::calculateAverageAbsoluteAcceleration() {
-  const auto fractionVector =
-      math::getSubvectorFromVector(m_totalAcceleration, 0, getFractionIndex());
-  m_averageAbsoluteAcceleration = math::absSum(fractionVector) / fractionVector.size();
+  const auto fraction           = m_totalAcceleration.first(getFractionIndex() + 1);
+  m_averageAbsoluteAcceleration = math::absSum(fraction) / fraction.size();
 }
 
 /**
@@ -0,0 +1,151 @@
+#include "proseco_planning/trajectory/trajectoryMemo.h"
+
+#include <cassert>
+#include <utility>
+
+namespace proseco_planning {
+
+/**
+ * @brief Constructs a new, empty memo.
+ *
+ * @param nAgents The number of agents.
+ */
+TrajectoryMemo::TrajectoryMemo(const std::size_t nAgents) : m_entries(nAgents) {}
+
+/**
+ * @brief Returns the entry for the action of an agent.
+ *
+ * @param agentIdx The index of the agent.
+ * @param actionId The id of the action.
+ * @return const Entry* The entry, nullptr if the action of the agent has not been executed yet.
+ */
+const TrajectoryMemo::Entry* TrajectoryMemo::find(const std::size_t agentIdx,
+                                                  const ActionId actionId) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto& entries = m_entries[agentIdx];
+  const Entry* entry{actionId < entries.size() ? entries[actionId].get() : nullptr};
+  ++(entry != nullptr ? m_statistics.trajectoryHits : m_statistics.trajectoryMisses);
+  return entry;
+}
+
+/**
+ * @brief Inserts the entry for the action of an agent, unless it already exists.
+ *
+ * @param agentIdx The index of the agent.
+ * @param actionId The id of the action.
+ * @param entry The result of executing the action.
+ * @return const Entry* The entry stored in the memo, i.e. the existing one if another thread has
+ * inserted an entry for the action in the meantime.
+ */
+const TrajectoryMemo::Entry* TrajectoryMemo::insert(const std::size_t agentIdx,
+                                                    const ActionId actionId, Entry entry) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& entries = m_entries[agentIdx];
+  if (actionId >= entries.size()) entries.resize(actionId + 1);
+  if (entries[actionId] == nullptr) {
+    entries[actionId] = std::make_unique<const Entry>(std::move(entry));
+  }
+  return entries[actionId].get();
+}
+
+/**
+ * @brief Returns the result of the collision check between two agents executing their actions.
+ *
+ * @param agentIdx0 The index of the first agent.
+ * @param actionId0 The id of the action of the first agent.
+ * @param agentIdx1 The index of the second agent.
+ * @param actionId1 The id of the action of the second agent.
+ * @return std::optional<bool> The result, empty if the agents have not been checked for these
+ * actions yet.
+ */
+std::optional<bool> TrajectoryMemo::findCollision(const std::size_t agentIdx0,
+                                                  const ActionId actionId0,
+                                                  const std::size_t agentIdx1,
+                                                  const ActionId actionId1) const {
+  const auto key = collisionKey(agentIdx0, actionId0, agentIdx1, actionId1);
+  std::optional<bool> collision;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (const auto it = m_collisions.find(key); it != m_collisions.end()) collision = it->second;
+  ++(collision ? m_statistics.collisionHits : m_statistics.collisionMisses);
+  return collision;
+}
+
+/**
+ * @brief Inserts the result of the collision check between two agents executing their actions.
+ *
+ * @param agentIdx0 The index of the first agent.
+ * @param actionId0 The id of the action of the first agent.
+ * @param agentIdx1 The index of the second agent.
+ * @param actionId1 The id of the action of the second agent.
+ * @param collision The result of the collision check.
+ */
+void TrajectoryMemo::insertCollision(const std::size_t agentIdx0, const ActionId actionId0,
+                                     const std::size_t agentIdx1, const ActionId actionId1,
+                                     const bool collision) {
+  const auto key = collisionKey(agentIdx0, actionId0, agentIdx1, actionId1);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_collisions.emplace(key, collision);
+}
+
+/**
+ * @brief Returns the number of entries of all agents.
+ *
+ * @return std::size_t The number of entries.
+ */
+std::size_t TrajectoryMemo::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::size_t size{0};
+  for (const auto& entries : m_entries) {
+    for (const auto& entry : entries) {
+      if (entry != nullptr) ++size;
+    }
+  }
+  return size;
+}
+
+/**
+ * @brief Returns the hits and misses of the lookups of this memo.
+ *
+ * @return Statistics The lookup statistics.
+ */
+TrajectoryMemo::Statistics TrajectoryMemo::statistics() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_statistics;
+}
+
+/**
+ * @brief Adds the lookup statistics of another memo.
+ *
+ * @param other The lookup statistics to add.
+ * @return Statistics& The summed lookup statistics.
+ */
+TrajectoryMemo::Statistics& TrajectoryMemo::Statistics::operator+=(const Statistics& other) {
+  trajectoryHits += other.trajectoryHits;
+  trajectoryMisses += other.trajectoryMisses;
+  collisionHits += other.collisionHits;
+  collisionMisses += other.collisionMisses;
+  return *this;
+}
+
+/**
+ * @brief Packs both agents and their actions into the key of a collision check. The key does not
+ * depend on the order of the agents.
+ *
+ * @param agentIdx0 The index of the first agent.
+ * @param actionId0 The id of the action of the first agent.
+ * @param agentIdx1 The index of the second agent.
+ * @param actionId1 The id of the action of the second agent.
+ * @return std::uint64_t The key.
+ */
+std::uint64_t TrajectoryMemo::collisionKey(std::size_t agentIdx0, ActionId actionId0,
+                                           std::size_t agentIdx1, ActionId actionId1) const {
+  if (agentIdx0 > agentIdx1) {
+    std::swap(agentIdx0, agentIdx1);
+    std::swap(actionId0, actionId1);
+  }
+  assert(agentIdx1 < m_entries.size() && "unknown agent");
+  assert(actionId0 < (1u << 24) && actionId1 < (1u << 24) && "action id exceeds 24 bits");
+  const std::uint64_t agentPair{agentIdx0 * m_entries.size() + agentIdx1};
+  return (agentPair << 48) | (std::uint64_t{actionId0} << 24) | actionId1;
+}
+}  // namespace proseco_planning
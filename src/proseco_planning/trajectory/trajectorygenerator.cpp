@@ -4,6 +4,7 @@
 #include <iostream>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #include "proseco_planning/agent/vehicle.h"
 #include "proseco_planning/config/configuration.h"
@@ -66,6 +67,79 @@ Trajectory TrajectoryGenerator::createTrajectory(float t0, ActionPtr action,
   return trajectory;
 }
 
+/**
+ * @brief Creates the trajectories of several actions from the same state of the vehicle.
+ * @details The trajectories are identical to the ones of `createTrajectory` up to floating point
+ * rounding, but the generators can evaluate the samples of all actions at once.
+ *
+ * @param t0 The start time of the trajectories.
+ * @param actions The actions.
+ * @param vehicle The current state of the vehicle.
+ * @return std::vector<Trajectory> The trajectory of each action.
+ */
+std::vector<Trajectory> TrajectoryGenerator::createTrajectories(float t0, const ActionSet& actions,
+                                                                const Vehicle& vehicle) const {
+  std::vector<Trajectory> trajectories;
+  createTrajectories(t0, actions, vehicle, trajectories);
+  return trajectories;
+}
+
+/**
+ * @brief Creates the trajectories of several actions from the same state of the vehicle into
+ * existing trajectories, e.g. the ones of a previous call, whose vectors are reused.
+ *
+ * @param t0 The start time of the trajectories.
+ * @param actions The actions.
+ * @param vehicle The current state of the vehicle.
+ * @param trajectories The trajectories, resized to the number of actions.
+ */
+void TrajectoryGenerator::createTrajectories(float t0, const ActionSet& actions,
+                                             const Vehicle& vehicle,
+                                             std::vector<Trajectory>& trajectories) const {
+  std::vector<BoundaryConditions> boundaryConditions;
+  boundaryConditions.reserve(actions.size());
+  for (const auto& action : actions) {
+    boundaryConditions.push_back(createBoundaryConditions(action, vehicle));
+  }
+
+  if (trajectories.size() > actions.size()) {
+    trajectories.erase(trajectories.begin() + actions.size(), trajectories.end());
+  }
+  for (auto& trajectory : trajectories) {
+    trajectory.reset(t0, vehicle.m_heading);
+  }
+  while (trajectories.size() < actions.size()) {
+    trajectories.emplace_back(t0, vehicle.m_heading);
+  }
+
+  calculateTrajectories(vehicle, t0, boundaryConditions, trajectories);
+  for (std::size_t i = 0; i < trajectories.size(); ++i) {
+    const auto& [startS, startD, endS, endD] = boundaryConditions[i];
+    evaluateTrajectory(trajectories[i], startS, startD, endS, endD);
+    updateFinalState(trajectories[i]);
+  }
+}
+
+/**
+ * @brief Calculates the discrete representation of the trajectories of several actions from the
+ * same state of the vehicle. The default implementation calculates them one after another.
+ *
+ * @param vehicle The current state of the vehicle.
+ * @param t0 The start time of the trajectories.
+ * @param boundaryConditions The boundary conditions of each trajectory.
+ * @param trajectories The trajectory of each set of boundary conditions, newly constructed or
+ * reset.
+ */
+void TrajectoryGenerator::calculateTrajectories(
+    const Vehicle& vehicle, const float t0,
+    const std::vector<BoundaryConditions>& boundaryConditions,
+    std::vector<Trajectory>& trajectories) const {
+  for (std::size_t i = 0; i < trajectories.size(); ++i) {
+    const auto& [startS, startD, endS, endD] = boundaryConditions[i];
+    trajectories[i] = calculateTrajectory(vehicle, t0, startS, startD, endS, endD);
+  }
+}
+
 /**
  * @brief Calculates the costs of acceleration based on the boundary conditions.
  *
@@ -0,0 +1,52 @@
+#include "proseco_planning/util/arena.h"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace proseco_planning::util {
+
+/// The size of a transparent huge page.
+static constexpr std::size_t hugePageSize{2 * 1024 * 1024};
+
+/**
+ * @brief Allocates a slab of memory that is suitably aligned for any object type.
+ * @details If huge pages are requested and the slab spans at least one huge page, the slab is
+ * aligned and padded to the huge page size and the kernel is advised to back it with transparent
+ * huge pages (Linux only). Smaller slabs are allocated regularly to avoid the padding.
+ *
+ * @param bytes The size of the slab in bytes.
+ * @param hugePages Flag for requesting huge page backing.
+ * @return void* The pointer to the slab.
+ */
+void* allocateSlab(const std::size_t bytes, const bool hugePages) {
+  if (hugePages && bytes >= hugePageSize) {
+    const std::size_t paddedBytes{(bytes + hugePageSize - 1) / hugePageSize * hugePageSize};
+    void* slab = std::aligned_alloc(hugePageSize, paddedBytes);
+    if (slab == nullptr) throw std::bad_alloc();
+#ifdef __linux__
+    madvise(slab, paddedBytes, MADV_HUGEPAGE);
+#endif
+    return slab;
+  }
+  return ::operator new(bytes);
+}
+
+/**
+ * @brief Releases a slab allocated with `allocateSlab`.
+ *
+ * @param slab The pointer to the slab.
+ * @param bytes The size of the slab in bytes.
+ * @param hugePages Flag indicating whether huge page backing has been requested for the slab.
+ */
+void freeSlab(void* slab, const std::size_t bytes, const bool hugePages) {
+  if (hugePages && bytes >= hugePageSize) {
+    std::free(slab);
+  } else {
+    ::operator delete(slab, bytes);
+  }
+}
+}  // namespace proseco_planning::util
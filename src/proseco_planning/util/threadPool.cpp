@@ -0,0 +1,146 @@
+#include "proseco_planning/util/threadPool.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+
+namespace proseco_planning::util {
+
+namespace {
+/// The pool the current thread is a worker of, `nullptr` for other threads.
+thread_local const ThreadPool* currentPool{nullptr};
+/// The index of the current thread within its pool.
+thread_local std::size_t currentIndex{0};
+}  // namespace
+
+/**
+ * @brief Constructs a thread pool and starts the worker threads.
+ *
+ * @param nThreads The number of worker threads, at least one.
+ * @param pinning Flag for pinning the i-th worker to the i-th CPU core (Linux only).
+ */
+ThreadPool::ThreadPool(const unsigned int nThreads, const bool pinning) : m_pinning(pinning) {
+  const unsigned int size{std::max(nThreads, 1u)};
+  for (unsigned int i = 0; i < size; ++i) {
+    m_queues.push_back(std::make_unique<Queue>());
+  }
+  for (unsigned int i = 0; i < size; ++i) {
+    m_threads.emplace_back(&ThreadPool::work, this, i);
+  }
+}
+
+/**
+ * @brief Finishes all queued tasks and joins the worker threads.
+ */
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_condition.notify_all();
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+/**
+ * @brief Claims and runs the invocations of a `ThreadPool::parallelFor` call until none are left.
+ *
+ * @param state The shared state of the call.
+ */
+void ThreadPool::runFor(ForState& state) {
+  for (auto i = state.next.fetch_add(1); i < state.n; i = state.next.fetch_add(1)) {
+    try {
+      state.function(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (!state.exception) state.exception = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (++state.done == state.n) state.finished.notify_all();
+  }
+}
+
+/**
+ * @brief Queues a task: workers push to their own queue, other threads distribute the tasks
+ * round-robin.
+ *
+ * @param task The task.
+ */
+void ThreadPool::push(Task task) {
+  const std::size_t index{currentPool == this ? currentIndex
+                                              : m_next.fetch_add(1) % m_queues.size()};
+  {
+    std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+    m_queues[index]->tasks.push_back(std::move(task));
+  }
+  ++m_pending;
+  // the lock ensures that a worker either observes the pending task or is already waiting
+  { std::lock_guard<std::mutex> lock(m_mutex); }
+  m_condition.notify_one();
+}
+
+/**
+ * @brief Takes a task from the back of the own queue or steals one from the front of another
+ * queue.
+ *
+ * @param index The index of the worker.
+ * @param task The task, set if one has been found.
+ * @return true If a task has been found.
+ */
+bool ThreadPool::tryPop(const std::size_t index, Task& task) {
+  {
+    auto& queue = *m_queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+  for (std::size_t offset = 1; offset < m_queues.size(); ++offset) {
+    auto& queue = *m_queues[(index + offset) % m_queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief The loop of a worker thread: runs tasks until the pool is stopped and all tasks are done.
+ *
+ * @param index The index of the worker.
+ */
+void ThreadPool::work(const std::size_t index) {
+  currentPool  = this;
+  currentIndex = index;
+#ifdef __linux__
+  if (m_pinning) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(index % std::max(std::thread::hardware_concurrency(), 1u), &cpuSet);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+  }
+#endif
+
+  Task task;
+  while (true) {
+    if (tryPop(index, task)) {
+      --m_pending;
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_stop || m_pending > 0; });
+    if (m_stop && m_pending == 0) return;
+  }
+}
+}  // namespace proseco_planning::util
@@ -8,18 +8,21 @@
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
-#include <map>
 #include <memory>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "proseco_planning/action/action.h"
 #include "proseco_planning/action/actionClass.h"
+#include "proseco_planning/agent/actionStatistics.h"
 #include "proseco_planning/agent/agent.h"
+#include "proseco_planning/config/computeOptions.h"
 #include "proseco_planning/config/configuration.h"
 #include "proseco_planning/config/defaultConfiguration.h"
 #include "proseco_planning/config/scenarioOptions.h"
+#include "proseco_planning/math/mathlib.h"
 
 using namespace proseco_planning;
 
@@ -40,14 +43,12 @@ struct AgentFixture {
     auto doNothing1 = std::make_shared<Action>(0.0, 0.0);
     auto doNothing2 = std::make_shared<Action>(0.0, 0.0);
     auto doNothing3 = std::make_shared<Action>(0.0, 0.0);
-    agents[0].m_actionValues.insert(std::make_pair(doNothing0, 10.4));
-    agents[0].m_actionValues.insert(std::make_pair(doNothing1, 10.1));
-    agents[0].m_actionValues.insert(std::make_pair(doNothing2, 11.5));
-    agents[0].m_actionValues.insert(std::make_pair(doNothing3, 11.3));
-    agents[0].m_actionVisits.insert(std::make_pair(doNothing0, 23));
-    agents[0].m_actionVisits.insert(std::make_pair(doNothing1, 0));
-    agents[0].m_actionVisits.insert(std::make_pair(doNothing2, 98));
-    agents[0].m_actionVisits.insert(std::make_pair(doNothing3, 4));
+    auto& statistics = agents[0].m_actionStatistics;
+    for (const auto& action : {doNothing0, doNothing1, doNothing2, doNothing3}) {
+      statistics.add(action);
+    }
+    statistics.m_values = {10.4f, 10.1f, 11.5f, 11.3f};
+    statistics.m_visits = {23.0f, 0.0f, 98.0f, 4.0f};
   }
 
   ~AgentFixture() { Config::get()->reset(); }
@@ -67,4 +68,60 @@ BOOST_AUTO_TEST_CASE(cumulativeActionVisits) {
   auto visits = agents[0].cumulativeActionVisits();
   BOOST_CHECK_CLOSE(visits, 125, 0.0001);
 }
+BOOST_AUTO_TEST_CASE(actionStatistics) {
+  auto& statistics = agents[0].m_actionStatistics;
+  BOOST_CHECK_EQUAL(statistics.size(), 4);
+  BOOST_CHECK_EQUAL(statistics.nClasses(), 1);
+  BOOST_CHECK_EQUAL(statistics.classCount(statistics.m_classes[0]), 4);
+  BOOST_CHECK(agents[0].maxActionVisitsAction() == statistics.m_actions[2]);
+
+  // a new action class is added to the class table, adding an action again has no effect
+  auto accelerate = std::make_shared<Action>(ActionClass::ACCELERATE);
+  BOOST_CHECK_EQUAL(statistics.add(accelerate), 4);
+  BOOST_CHECK_EQUAL(statistics.add(accelerate), 4);
+  BOOST_CHECK_EQUAL(statistics.nClasses(), 2);
+  BOOST_CHECK_EQUAL(statistics.classCount(ActionClass::ACCELERATE), 1);
+  BOOST_CHECK_EQUAL(statistics.m_classIds[4], 1);
+
+  // actions are identified by their pointer
+  auto other = std::make_shared<Action>(ActionClass::ACCELERATE);
+  BOOST_CHECK_EQUAL(statistics.find(other), ActionStatistics::npos);
+  BOOST_CHECK_THROW(statistics.visits(other), std::out_of_range);
+  BOOST_CHECK_THROW(statistics.classIndex(ActionClass::DECELERATE), std::out_of_range);
+}
+BOOST_AUTO_TEST_CASE(incrementalStatistics) {
+  auto& statistics = agents[0].m_actionStatistics;
+  // the fixture writes the statistics directly
+  statistics.invalidate();
+  BOOST_CHECK_CLOSE(statistics.totalVisits(), 125, 0.0001);
+  BOOST_CHECK_CLOSE(statistics.minValue(), 10.1, 0.0001);
+  BOOST_CHECK_CLOSE(statistics.maxValue(), 11.5, 0.0001);
+
+  // the maximum moves inwards, the minimum outwards
+  statistics.setValue(2, 10.0f);
+  statistics.addVisits(2, 1.0f);
+  statistics.addVisits(1, 2.0f);
+  BOOST_CHECK_CLOSE(statistics.minValue(), 10.0, 0.0001);
+  BOOST_CHECK_CLOSE(statistics.maxValue(), 11.3, 0.0001);
+
+  // the incrementally maintained statistics match a recomputation from scratch
+  auto recomputed = statistics;
+  recomputed.invalidate();
+  BOOST_CHECK_CLOSE(statistics.totalVisits(), 128, 0.0001);
+  BOOST_CHECK_CLOSE(statistics.totalVisits(), recomputed.totalVisits(), 0.0001);
+  BOOST_CHECK_CLOSE(statistics.m_classVisits[0], recomputed.m_classVisits[0], 0.0001);
+  BOOST_CHECK_CLOSE(statistics.m_classValues[0], recomputed.m_classValues[0], 0.0001);
+
+  // the lazily evaluated UCT values match an eager evaluation
+  const float cp{cOpt().uct_cp};
+  const auto& uctValues = statistics.uctScores(cp);
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    const float uct{math::UCT(math::normalize(statistics.m_values[i], 11.3f, 10.0f),
+                              statistics.m_visits[i], 128.0f, cp)};
+    BOOST_CHECK_CLOSE(uctValues[i], uct, 0.0001);
+  }
+  BOOST_CHECK_EQUAL(statistics.argmaxUCT(cp), math::argmax(uctValues));
+  statistics.addVisits(3, 1.0f);
+  BOOST_CHECK_EQUAL(statistics.argmaxUCT(cp), math::argmax(statistics.uctScores(cp)));
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -10,7 +10,6 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
 #include <cstddef>
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -123,15 +122,16 @@ BOOST_AUTO_TEST_CASE(best_action_set) {
     agent.addAvailableAction(decelerate);
     agent.addAvailableAction(changeRightSlow);
 
-    agent.m_actionValues.at(accelerate)      = 950.f;
-    agent.m_actionValues.at(changeLeftFast)  = 900.f;
-    agent.m_actionValues.at(decelerate)      = 100.f;
-    agent.m_actionValues.at(changeRightSlow) = 1000.f;
+    auto& statistics = agent.m_actionStatistics;
+    statistics.value(accelerate)      = 950.f;
+    statistics.value(changeLeftFast)  = 900.f;
+    statistics.value(decelerate)      = 100.f;
+    statistics.value(changeRightSlow) = 1000.f;
 
-    agent.m_actionVisits.at(accelerate)      = 20.f;
-    agent.m_actionVisits.at(changeLeftFast)  = 20.f;
-    agent.m_actionVisits.at(decelerate)      = 20.f;
-    agent.m_actionVisits.at(changeRightSlow) = 5.f;
+    statistics.visits(accelerate)      = 20.f;
+    statistics.visits(changeLeftFast)  = 20.f;
+    statistics.visits(decelerate)      = 20.f;
+    statistics.visits(changeRightSlow) = 5.f;
   }
   setBestActionSet(node);
 
@@ -177,13 +177,13 @@ BOOST_AUTO_TEST_CASE(best_action_set_all_values_equal) {
   ActionPtr changeRightFast = std::make_shared<Action>(5.f, -1.0f);
 
   for (auto& agent : node->m_agents) {
-    agent.m_actionValues.insert({accelerate, 1000.f});
-    agent.m_actionValues.insert({changeLeftFast, 1000.f});
-    agent.m_actionValues.insert({changeRightFast, 1000.f});
+    auto& statistics = agent.m_actionStatistics;
+    statistics.add(accelerate);
+    statistics.add(changeLeftFast);
+    statistics.add(changeRightFast);
 
-    agent.m_actionVisits.insert({accelerate, 20.f});
-    agent.m_actionVisits.insert({changeLeftFast, 20.f});
-    agent.m_actionVisits.insert({changeRightFast, 20.f});
+    statistics.m_values = {1000.f, 1000.f, 1000.f};
+    statistics.m_visits = {20.f, 20.f, 20.f};
   }
   setBestActionSet(node);
 
@@ -209,13 +209,13 @@ BOOST_AUTO_TEST_CASE(best_action_set_with_move_grouping) {
   for (auto& agent : node->m_agents) {
     m_bestActionClassSet.push_back(ActionClass::DO_NOTHING);
 
-    agent.m_actionValues.insert({accelerate, 1000.f});
-    agent.m_actionValues.insert({changeLeftFast, 1000.f});
-    agent.m_actionValues.insert({doNothing, 500.f});
+    auto& statistics = agent.m_actionStatistics;
+    statistics.add(accelerate);
+    statistics.add(changeLeftFast);
+    statistics.add(doNothing);
 
-    agent.m_actionVisits.insert({accelerate, 20.f});
-    agent.m_actionVisits.insert({changeLeftFast, 20.f});
-    agent.m_actionVisits.insert({doNothing, 5.f});
+    statistics.m_values = {1000.f, 1000.f, 500.f};
+    statistics.m_visits = {20.f, 20.f, 5.f};
   }
   setBestActionSet(node);
 
@@ -236,15 +236,15 @@ BOOST_AUTO_TEST_CASE(best_action_class_set) {
   auto node = root.get();
 
   for (auto& agent : node->m_agents) {
-    agent.m_actionClassValues.insert({ActionClass::ACCELERATE, 950.f});
-    agent.m_actionClassValues.insert({ActionClass::CHANGE_LEFT_FAST, 800.f});
-    agent.m_actionClassValues.insert({ActionClass::DECELERATE, 100.f});
-    agent.m_actionClassValues.insert({ActionClass::CHANGE_RIGHT_SLOW, 1000.f});
-
-    agent.m_actionClassVisits.insert({ActionClass::ACCELERATE, 20.f});
-    agent.m_actionClassVisits.insert({ActionClass::CHANGE_LEFT_FAST, 20.f});
-    agent.m_actionClassVisits.insert({ActionClass::DECELERATE, 20.f});
-    agent.m_actionClassVisits.insert({ActionClass::CHANGE_RIGHT_SLOW, 5.f});
+    // the action classes are added to the class table along with an action of each class
+    auto& statistics = agent.m_actionStatistics;
+    statistics.add(std::make_shared<Action>(ActionClass::ACCELERATE));
+    statistics.add(std::make_shared<Action>(ActionClass::CHANGE_LEFT_FAST));
+    statistics.add(std::make_shared<Action>(ActionClass::DECELERATE));
+    statistics.add(std::make_shared<Action>(ActionClass::CHANGE_RIGHT_SLOW));
+
+    statistics.m_classValues = {950.f, 800.f, 100.f, 1000.f};
+    statistics.m_classVisits = {20.f, 20.f, 20.f, 5.f};
   }
   setBestActionClass(node);
 
@@ -277,13 +277,14 @@ BOOST_AUTO_TEST_CASE(best_action_class_set_all_values_equal) {
   auto node = root.get();
 
   for (auto& agent : node->m_agents) {
-    agent.m_actionClassValues.insert({ActionClass::ACCELERATE, 1000.f});
-    agent.m_actionClassValues.insert({ActionClass::CHANGE_LEFT_FAST, 1000.f});
-    agent.m_actionClassValues.insert({ActionClass::CHANGE_RIGHT, 1000.f});
-
-    agent.m_actionClassVisits.insert({ActionClass::ACCELERATE, 20.f});
-    agent.m_actionClassVisits.insert({ActionClass::CHANGE_LEFT_FAST, 20.f});
-    agent.m_actionClassVisits.insert({ActionClass::CHANGE_RIGHT, 20.f});
+    // the action classes are added to the class table along with an action of each class
+    auto& statistics = agent.m_actionStatistics;
+    statistics.add(std::make_shared<Action>(ActionClass::ACCELERATE));
+    statistics.add(std::make_shared<Action>(ActionClass::CHANGE_LEFT_FAST));
+    statistics.add(std::make_shared<Action>(ActionClass::CHANGE_RIGHT));
+
+    statistics.m_classValues = {1000.f, 1000.f, 1000.f};
+    statistics.m_classVisits = {20.f, 20.f, 20.f};
   }
   setBestActionClass(node);
 
@@ -43,4 +43,26 @@ BOOST_AUTO_TEST_CASE(cumulativeDiscountedReward) {
   auto cumulative_discounted_reward3 =
       UpdatePolicy::cumulativeDiscountedReward(0.99, 1, 4, agents_rewards, 2);
   BOOST_CHECK_CLOSE(cumulative_discounted_reward3, -2.32249, 0.0001);
-}
\ No newline at end of file
+}
+BOOST_AUTO_TEST_CASE(cumulativeDiscountedRewards) {
+  std::vector<float> rewards0{0.5f, 0.5f, 0.5f};
+  std::vector<float> rewards1{2.f, 2.f, 2.f};
+  std::vector<float> rewards2{5.f, 5.f, 5.f};
+  std::vector<float> rewards3{-10.f, -10.f, -10.f};
+  std::vector<std::vector<float>> agents_rewards{rewards0, rewards1, rewards2, rewards3};
+
+  // the returns of all depths match the returns calculated separately for each depth
+  std::vector<std::vector<float>> returns;
+  for (int simulation_depth = 1; simulation_depth <= 4; ++simulation_depth) {
+    UpdatePolicy::cumulativeDiscountedRewards(0.99, simulation_depth, agents_rewards, returns);
+    for (int node_depth = 1; node_depth <= simulation_depth; ++node_depth) {
+      for (int agent_idx = 0; agent_idx < 3; ++agent_idx) {
+        BOOST_CHECK_CLOSE(returns[node_depth - 1][agent_idx],
+                          UpdatePolicy::cumulativeDiscountedReward(
+                              0.99, node_depth, simulation_depth, agents_rewards, agent_idx),
+                          0.0001);
+      }
+    }
+  }
+  BOOST_CHECK_CLOSE(returns[1][0], -2.851, 0.0001);
+}
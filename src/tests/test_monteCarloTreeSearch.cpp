@@ -0,0 +1,118 @@
+/**
+ * @file test_monteCarloTreeSearch.cpp
+ * @brief This file defines the test cases for the Monte Carlo Tree Search.
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#include "proseco_planning/action/action.h"
+#include "proseco_planning/action/actionClass.h"
+#include "proseco_planning/config/computeOptions.h"
+#include "proseco_planning/config/configuration.h"
+#include "proseco_planning/config/defaultConfiguration.h"
+#include "proseco_planning/config/scenarioOptions.h"
+#include "proseco_planning/monteCarloTreeSearch.h"
+#include "proseco_planning/node.h"
+#include "proseco_planning/searchContext.h"
+#include "proseco_planning/util/threadPool.h"
+
+using namespace proseco_planning;
+
+/**
+ * @brief Creates the default configuration with the given early stopping parameters.
+ *
+ * @param active The flag that indicates whether early stopping is enabled.
+ * @param budgetFraction The fraction of the remaining iterations the lead has to exceed.
+ * @param nThreads The number of threads of the tree parallelization.
+ */
+void createConfig(const bool active, const float budgetFraction, const unsigned int nThreads = 1) {
+  json jOptions                   = config::optionsSimple.toJSON();
+  auto& jComputeOptions           = jOptions["compute_options"];
+  jComputeOptions["n_iterations"] = 500;
+  auto& jPolicyEnhancements       = jComputeOptions["policy_options"]["policy_enhancements"];
+  jPolicyEnhancements["early_stopping"] =
+      config::EarlyStopping(active, 50, budgetFraction).toJSON();
+  auto& jParallelizationOptions        = jComputeOptions["parallelization_options"];
+  jParallelizationOptions["n_threads"] = nThreads;
+  jParallelizationOptions["mode"]      = "tree";
+  Config::create(config::scenarioSimple, config::Options::fromJSON(jOptions));
+}
+
+struct MonteCarloTreeSearchFixture {
+  ~MonteCarloTreeSearchFixture() { Config::get()->reset(); }
+};
+
+BOOST_FIXTURE_TEST_SUITE(monteCarloTreeSearch, MonteCarloTreeSearchFixture)
+
+BOOST_AUTO_TEST_CASE(iteration_count) {
+  createConfig(false, 0.0f);
+  SearchContext context(cOpt().parallelization_options);
+  const auto actionSetSequence =
+      computeActionSetSequence(std::make_unique<Node>(sOpt().agents), 0, context);
+  BOOST_CHECK(!actionSetSequence.empty());
+  BOOST_CHECK_EQUAL(context.lastIterationCount(), 500);
+}
+
+BOOST_AUTO_TEST_CASE(early_stopping) {
+  createConfig(true, 1.0f);
+  auto root = std::make_unique<Node>(sOpt().agents);
+  for (auto& agent : root->m_agents) {
+    agent.m_actionStatistics.add(std::make_shared<Action>(ActionClass::DO_NOTHING));
+    agent.m_actionStatistics.add(std::make_shared<Action>(ActionClass::ACCELERATE));
+    agent.m_actionStatistics.m_visits = {300.0f, 100.0f};
+  }
+
+  // the best actions have to be stable between two checks
+  std::vector<std::size_t> bestActions;
+  BOOST_CHECK(!isConverged(root.get(), bestActions, 100));
+  BOOST_CHECK(isConverged(root.get(), bestActions, 100));
+  // the lead of 200 visits could be overturned by the remaining iterations
+  BOOST_CHECK(!isConverged(root.get(), bestActions, 200));
+
+  // the best action of one agent changes
+  root->m_agents[0].m_actionStatistics.m_visits = {100.0f, 300.0f};
+  BOOST_CHECK(!isConverged(root.get(), bestActions, 100));
+  BOOST_CHECK(isConverged(root.get(), bestActions, 100));
+  BOOST_CHECK_EQUAL(bestActions[0], 1);
+  BOOST_CHECK_EQUAL(bestActions[1], 0);
+
+  // the virtual visits of iterations in progress are not counted
+  BOOST_CHECK(!isConverged(root.get(), bestActions, 100, {{0.0f, 250.0f}}));
+  BOOST_CHECK_EQUAL(bestActions[0], 0);
+}
+
+BOOST_AUTO_TEST_CASE(shared_tree) {
+  createConfig(false, 0.0f, 4);
+  const auto nThreads{cOpt().parallelization_options.n_threads};
+  util::ThreadPool threadPool(nThreads, false);
+  auto root = computeSharedTree(std::make_unique<Node>(sOpt().agents), nThreads, 0, threadPool);
+  // every iteration is backpropagated
+  BOOST_CHECK_EQUAL(root->m_visits, cOpt().n_iterations);
+
+  // action sets that are selected concurrently are expanded only once, i.e. every node of the arena
+  // is part of the tree
+  std::size_t nNodes{0};
+  std::vector<const Node*> nodes{root.get()};
+  while (!nodes.empty()) {
+    const auto node = nodes.back();
+    nodes.pop_back();
+    for (const auto child : node->m_childMap) {
+      BOOST_CHECK(!child->m_pending);
+      nodes.push_back(child);
+      ++nNodes;
+    }
+  }
+  BOOST_CHECK_EQUAL(root->arenaSize(), nNodes);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
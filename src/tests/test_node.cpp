@@ -8,7 +8,11 @@
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include "proseco_planning/action/action.h"
@@ -17,10 +21,13 @@
 #include "proseco_planning/agent/desire.h"
 #include "proseco_planning/agent/vehicle.h"
 #include "proseco_planning/collision_checker/collisionChecker.h"
+#include "proseco_planning/config/computeOptions.h"
 #include "proseco_planning/config/configuration.h"
 #include "proseco_planning/config/defaultConfiguration.h"
 #include "proseco_planning/config/scenarioOptions.h"
 #include "proseco_planning/node.h"
+#include "proseco_planning/searchContext.h"
+#include "proseco_planning/trajectory/trajectoryMemo.h"
 #include "proseco_planning/trajectory/trajectorygenerator.h"
 #include "proseco_planning/util/alias.h"
 
@@ -89,4 +96,261 @@ BOOST_AUTO_TEST_CASE(validity) {
   BOOST_REQUIRE(node->m_invalid);
 }
 
+BOOST_AUTO_TEST_CASE(node_arena) {
+  auto root = std::make_unique<Node>(agents);
+  root->reserveNodes(4, false);
+
+  ActionSet actionSet{std::make_shared<Action>(ActionClass::DO_NOTHING)};
+  auto child      = root->addChild(actionSet);
+  auto grandChild = child->addChild(actionSet);
+
+  // all descendants are owned by the arena of the root node
+  BOOST_CHECK_EQUAL(root->arenaSize(), 2);
+  BOOST_CHECK_EQUAL(child->arenaSize(), 0);
+  BOOST_CHECK_EQUAL(root->getChild(actionSet), child);
+  BOOST_CHECK_EQUAL(child->getChild(actionSet), grandChild);
+  BOOST_CHECK_EQUAL(grandChild->m_parent, child);
+  BOOST_CHECK_EQUAL(grandChild->m_depth, 2);
+}
+
+BOOST_AUTO_TEST_CASE(release_trees) {
+  auto root   = std::make_unique<Node>(agents);
+  auto action = std::make_shared<Action>(ActionClass::DO_NOTHING);
+  root->addChild(ActionSet{action})->addChild(ActionSet{action});
+  const std::weak_ptr<Action> weakAction{action};
+  action.reset();
+
+  SearchContext context(cOpt().parallelization_options);
+  std::vector<std::unique_ptr<Node>> roots;
+  roots.push_back(std::move(root));
+  context.releaseTrees(std::move(roots));
+  context.waitForRelease();
+
+  // the nodes referencing the action have been destroyed
+  BOOST_CHECK(weakAction.expired());
+}
+
+BOOST_AUTO_TEST_CASE(child_index) {
+  auto root = std::make_unique<Node>(agents);
+  std::vector<ActionSet> actionSets;
+  std::vector<Node*> children;
+  for (int i = 0; i < 100; ++i) {
+    actionSets.push_back({std::make_shared<Action>(ActionClass::DO_NOTHING)});
+    children.push_back(root->addChild(actionSets.back()));
+  }
+  BOOST_CHECK_EQUAL(root->m_childMap.size(), 100);
+  // the actions are interned in the action statistics of the agent
+  BOOST_CHECK_EQUAL(root->m_agents[0].m_actionStatistics.size(), 100);
+
+  // adding the same action ids again is rejected
+  BOOST_CHECK(!root->m_childMap.insert(children[42]->m_actionIds, children[0]));
+
+  // equal action sets refer to the same child, regardless of the vector instance
+  for (int i = 0; i < 100; ++i) {
+    ActionSet actionSet{actionSets[i][0]};
+    BOOST_CHECK_EQUAL(root->getChild(actionSet), children[i]);
+    BOOST_CHECK_EQUAL(root->getChild(ActionIdSet{static_cast<ActionId>(i)}), children[i]);
+    BOOST_CHECK(children[i]->actionSet() == actionSets[i]);
+  }
+
+  // the children are iterated in insertion order
+  int i = 0;
+  for (const auto child : root->m_childMap) {
+    BOOST_CHECK_EQUAL(root->m_childMap.actionId(i, 0), i);
+    BOOST_CHECK_EQUAL(child, children[i++]);
+  }
+
+  ActionSet unknown{std::make_shared<Action>(ActionClass::DO_NOTHING)};
+  BOOST_CHECK(root->findChild(unknown) == nullptr);
+  BOOST_CHECK(root->findActionIds(unknown).empty());
+  BOOST_CHECK_EQUAL(root->m_childMap.count(ActionIdSet{100}), 0);
+  BOOST_CHECK_THROW(root->getChild(unknown), std::out_of_range);
+  BOOST_CHECK_THROW(root->m_childMap.insert(ActionIdSet{0, 1}, children[0]), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(trajectory_memo) {
+  // add second and third agent for this test case
+  agents.push_back(agents[0]);
+  agents.push_back(agents[0]);
+  agents[1].m_id                  = 1;
+  agents[1].m_vehicle.m_positionX = 50;
+  agents[2].m_id                  = 2;
+  agents[2].m_vehicle.m_positionX = 100;
+
+  auto collisionChecker    = CollisionChecker::createCollisionChecker("circleApproximation");
+  auto trajectoryGenerator = TrajectoryGenerator::createTrajectoryGenerator("jerkOptimal");
+
+  auto root = std::make_unique<Node>(agents);
+  auto a0   = std::make_shared<Action>(ActionClass::DO_NOTHING, 1.0f, 0.0f);
+  auto b0   = std::make_shared<Action>(ActionClass::DO_NOTHING, -1.0f, 0.0f);
+  auto a1   = std::make_shared<Action>(ActionClass::DO_NOTHING, 2.0f, 0.0f);
+  auto b1   = std::make_shared<Action>(ActionClass::DO_NOTHING, -2.0f, 0.0f);
+  auto c2   = std::make_shared<Action>(ActionClass::DO_NOTHING, 0.0f, 0.0f);
+
+  std::vector<Node*> children;
+  for (const auto& actionSet :
+       {ActionSet{a0, a1, c2}, ActionSet{b0, a1, c2}, ActionSet{a0, b1, c2}}) {
+    children.push_back(root->addChild(actionSet));
+    children.back()->executeActions(actionSet, *collisionChecker, *trajectoryGenerator, false);
+  }
+  // each action of each agent has only been executed once
+  BOOST_CHECK_EQUAL(root->trajectoryMemoSize(), 5);
+  const auto statistics = root->trajectoryMemoStatistics();
+  BOOST_CHECK_EQUAL(statistics.trajectoryHits, 4);
+  BOOST_CHECK_EQUAL(statistics.trajectoryMisses, 5);
+  // each pair of actions of two agents has only been checked for collisions once
+  BOOST_CHECK_EQUAL(statistics.collisionHits, 2);
+  BOOST_CHECK_EQUAL(statistics.collisionMisses, 7);
+
+  // the shared trajectories equal the ones generated from the state of the parent
+  const auto trajectory = trajectoryGenerator->createTrajectory(0.0f, a0, agents[0].m_vehicle);
+  const auto& sharedTrajectory = children[2]->m_agents[0].m_trajectory;
+  BOOST_CHECK(std::ranges::equal(sharedTrajectory.m_sPosition, trajectory.m_sPosition));
+  BOOST_CHECK_EQUAL(children[2]->m_agents[0].m_actionCost, children[0]->m_agents[0].m_actionCost);
+  BOOST_CHECK_EQUAL(children[2]->m_agents[0].m_vehicle.m_positionX,
+                    children[0]->m_agents[0].m_vehicle.m_positionX);
+
+  // a copy of an executed node continues from its own state and does not use the memo
+  auto simulationNode = std::make_unique<Node>(children[0]);
+  simulationNode->executeActions({b0, b1, c2}, *collisionChecker, *trajectoryGenerator, false);
+  BOOST_CHECK_EQUAL(root->trajectoryMemoSize(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(memoize_available_actions) {
+  auto collisionChecker    = CollisionChecker::createCollisionChecker("circleApproximation");
+  auto trajectoryGenerator = TrajectoryGenerator::createTrajectoryGenerator("jerkOptimal");
+
+  auto root = std::make_unique<Node>(agents);
+  root->m_agents[0].setAvailableActions(root->m_depth);
+  root->memoizeAvailableActions(*collisionChecker, *trajectoryGenerator);
+  const auto actions = root->m_agents[0].m_availableActions;
+  BOOST_CHECK_EQUAL(root->trajectoryMemoSize(), actions.size());
+
+  // the children take the batched trajectories from the memo
+  auto child = root->addChild(ActionSet{actions[1]});
+  child->executeActions({actions[1]}, *collisionChecker, *trajectoryGenerator, false);
+  const auto statistics = root->trajectoryMemoStatistics();
+  BOOST_CHECK_EQUAL(statistics.trajectoryHits, 1);
+  BOOST_CHECK_EQUAL(statistics.trajectoryMisses, 0);
+
+  // the batched trajectories match the ones generated one at a time
+  auto reference = std::make_unique<Node>(root.get());
+  reference->executeActions({actions[1]}, *collisionChecker, *trajectoryGenerator, false);
+  BOOST_CHECK_CLOSE(child->m_agents[0].m_vehicle.m_positionX,
+                    reference->m_agents[0].m_vehicle.m_positionX, 1e-3);
+  BOOST_CHECK_CLOSE(child->m_agents[0].m_vehicle.m_velocityX,
+                    reference->m_agents[0].m_vehicle.m_velocityX, 1e-3);
+  BOOST_CHECK_CLOSE(child->m_agents[0].m_actionCost, reference->m_agents[0].m_actionCost, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(action_annotation) {
+  auto action = std::make_shared<Action>(ActionClass::DO_NOTHING);
+  // actions are not annotated by default
+  BOOST_CHECK(action->m_annotation == nullptr);
+  BOOST_CHECK_EQUAL(std::as_const(*action).annotation().m_selectionLikelihood, 0.0f);
+  BOOST_CHECK(action->m_annotation == nullptr);
+
+  action->annotation().m_selectionLikelihood = 0.5f;
+  BOOST_REQUIRE(action->m_annotation != nullptr);
+
+  // copies own their annotation
+  Action copy{*action};
+  copy.annotation().m_selectionLikelihood = 0.25f;
+  BOOST_CHECK_EQUAL(action->annotation().m_selectionLikelihood, 0.5f);
+  BOOST_CHECK_EQUAL(copy.annotation().m_selectionLikelihood, 0.25f);
+}
+
+BOOST_AUTO_TEST_CASE(reuse_subtree) {
+  auto collisionChecker    = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
+  auto trajectoryGenerator = TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+
+  // accelerate twice, then do nothing
+  auto previousRoot = std::make_unique<Node>(agents);
+  previousRoot->m_agents[0].setAvailableActions(previousRoot->m_depth);
+  ActionSet actionSet{previousRoot->m_agents[0].m_availableActions[1]};
+  auto child = previousRoot->addChild(actionSet);
+  child->executeActions(actionSet, *collisionChecker, *trajectoryGenerator, false);
+  ActionSet childActionSet{child->m_agents[0].m_availableActions[1]};
+  auto grandChild = child->addChild(childActionSet);
+  grandChild->executeActions(childActionSet, *collisionChecker, *trajectoryGenerator, false);
+  grandChild->addChild({grandChild->m_agents[0].m_availableActions[0]});
+  child->m_visits                                                 = 3;
+  child->m_agents[0].m_actionStatistics.visits(childActionSet[0]) = 2;
+  grandChild->m_visits                                            = 2;
+
+  // the observed state deviates slightly from the predicted state of the child
+  agents[0].m_vehicle = child->m_agents[0].m_vehicle;
+  agents[0].m_vehicle.m_positionX += 0.1f;
+  auto root = std::make_unique<Node>(agents);
+  BOOST_REQUIRE(root->matchesState(*child, 0.5f, 0.5f, 0.5f, 0.05f));
+  BOOST_REQUIRE(!root->matchesState(*child, 0.05f, 0.5f, 0.5f, 0.05f));
+
+  // the predictions of the subtree also depend on the acceleration and the heading
+  auto drifted = std::make_unique<Node>(agents);
+  drifted->m_agents[0].m_vehicle.m_accelerationX += 1.0f;
+  BOOST_CHECK(!drifted->matchesState(*child, 0.5f, 0.5f, 0.5f, 0.05f));
+  drifted = std::make_unique<Node>(agents);
+  drifted->m_agents[0].m_vehicle.m_heading += 0.1f;
+  BOOST_CHECK(!drifted->matchesState(*child, 0.5f, 0.5f, 0.5f, 0.05f));
+  BOOST_CHECK(drifted->matchesState(*child, 0.5f, 0.5f, 0.5f, 0.2f));
+  // the heading difference wraps around
+  drifted->m_agents[0].m_vehicle.m_heading += 2.0f * M_PI - 0.1f;
+  BOOST_CHECK(drifted->matchesState(*child, 0.5f, 0.5f, 0.5f, 0.05f));
+
+  root->reuseSubtree(child, *collisionChecker, *trajectoryGenerator);
+  previousRoot.reset();
+
+  BOOST_CHECK_EQUAL(root->m_visits, 3);
+  BOOST_CHECK_EQUAL(root->m_agents[0].m_vehicle.m_positionX, agents[0].m_vehicle.m_positionX);
+  BOOST_CHECK_EQUAL(root->arenaSize(), 2);
+
+  // the actions are created for the observed state and keep their statistics
+  const auto action = root->m_agents[0].m_availableActions[1];
+  BOOST_CHECK(action != childActionSet[0]);
+  BOOST_CHECK_EQUAL(root->m_agents[0].m_actionStatistics.visits(action), 2);
+
+  // the state of the child is obtained by executing the action in the observed state
+  auto newChild = root->getChild({action});
+  Node expected(root.get());
+  expected.executeActions({action}, *collisionChecker, *trajectoryGenerator, false);
+  BOOST_CHECK_EQUAL(newChild->m_visits, 2);
+  BOOST_CHECK_EQUAL(newChild->m_parent, root.get());
+  BOOST_CHECK_EQUAL(newChild->m_depth, 1);
+  BOOST_CHECK_EQUAL(newChild->m_agents[0].m_vehicle.m_positionX,
+                    expected.m_agents[0].m_vehicle.m_positionX);
+  BOOST_REQUIRE_EQUAL(newChild->m_childMap.size(), 1);
+  BOOST_CHECK_EQUAL((*newChild->m_childMap.begin())->m_depth, 2);
+}
+
+BOOST_AUTO_TEST_CASE(reuse_tree_action_fraction) {
+  auto jOptions            = config::optionsSimple.toJSON();
+  auto& jPolicyEnhancements = jOptions["compute_options"]["policy_options"]["policy_enhancements"];
+  jPolicyEnhancements["action_execution_fraction"] = 0.5f;
+  jPolicyEnhancements["tree_reuse"] =
+      config::TreeReuse(true, 0.5f, 0.5f, 0.5f, 0.05f).toJSON();
+  Config::reset();
+  Config::create(config::scenarioSimple, config::Options::fromJSON(jOptions));
+
+  auto collisionChecker    = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
+  auto trajectoryGenerator = TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+
+  SearchContext context(cOpt().parallelization_options);
+  for (const bool executeFraction : {true, false}) {
+    auto previousRoot = std::make_unique<Node>(agents);
+    previousRoot->m_agents[0].setAvailableActions(previousRoot->m_depth);
+    ActionSet actionSet{previousRoot->m_agents[0].m_availableActions[1]};
+    auto child = previousRoot->addChild(actionSet);
+    child->executeActions(actionSet, *collisionChecker, *trajectoryGenerator, false);
+    child->m_visits = 3;
+    context.retainTree(std::move(previousRoot), actionSet, 0);
+
+    auto observed = std::make_unique<Node>(agents);
+    observed->executeActions(actionSet, *collisionChecker, *trajectoryGenerator, executeFraction);
+    auto root = context.reuseTree(std::move(observed), 1);
+
+    // only a fraction of the action has been executed before the next planning step
+    BOOST_CHECK_EQUAL(root->m_visits, executeFraction ? 3 : 0);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
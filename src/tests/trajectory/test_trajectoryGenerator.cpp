@@ -8,13 +8,18 @@
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
+#include <algorithm>
+#include <eigen3/Eigen/Core>
+#include <eigen3/Eigen/LU>
 #include <memory>
+#include <string>
 
 #include "proseco_planning/action/action.h"
 #include "proseco_planning/action/actionClass.h"
 #include "proseco_planning/agent/vehicle.h"
 #include "proseco_planning/config/configuration.h"
 #include "proseco_planning/config/defaultConfiguration.h"
+#include "proseco_planning/trajectory/polynomialgenerator.h"
 #include "proseco_planning/trajectory/trajectory.h"
 #include "proseco_planning/trajectory/trajectorygenerator.h"
 
@@ -75,6 +80,12 @@ BOOST_AUTO_TEST_CASE(laneDetection) {
                       float(0.001));  // velocity deviation is less than 1mm/s
   BOOST_REQUIRE(vehiclePolynomialTrajectory.m_accelerationX == 0);
   BOOST_REQUIRE(vehiclePolynomialTrajectory.m_accelerationY == 0);
+
+  // the final states are stored by value
+  BOOST_CHECK_EQUAL(finalStateConstantAcceleration[1], vehicleConstantAcceleration.m_positionY);
+  BOOST_CHECK_EQUAL(finalStateConstantAcceleration[6], vehicleConstantAcceleration.m_lane);
+  BOOST_CHECK_EQUAL(finalStatePolynomial[1], vehiclePolynomialTrajectory.m_positionY);
+  BOOST_CHECK_EQUAL(finalStatePolynomial[6], vehiclePolynomialTrajectory.m_lane);
 }
 
 BOOST_AUTO_TEST_CASE(trajectoryGeneration) {
@@ -118,4 +129,128 @@ BOOST_AUTO_TEST_CASE(trajectoryGeneration) {
                       float(0.001));  // acceleration deviation is less than 1mm/s^2
 }
 
+BOOST_AUTO_TEST_CASE(quinticBasis) {
+  const float T{2.0f};
+  const QuinticBasis basis(T);
+  Eigen::Matrix<float, 1, 6> constraints;
+  constraints << 3.0f, 12.0f, -0.5f, 30.0f, 17.0f, 0.0f;
+
+  // reference: solve the constraint matrix for the start time zero
+  Eigen::Matrix<float, 6, 6> M;
+  M << 1, 0, 0, 0, 0, 0,                                         //
+      0, 1, 0, 0, 0, 0,                                          //
+      0, 0, 2, 0, 0, 0,                                          //
+      1, T, T * T, T * T * T, T * T * T * T, T * T * T * T * T,  //
+      0, 1, 2 * T, 3 * T * T, 4 * T * T * T, 5 * T * T * T * T,  //
+      0, 0, 2, 6 * T, 12 * T * T, 20 * T * T * T;
+  const Eigen::Matrix<float, 1, 6> expected =
+      M.partialPivLu().solve(constraints.transpose()).transpose();
+  const auto coeff = basis.coefficients(constraints);
+  for (int i = 0; i < 6; ++i) {
+    BOOST_CHECK_SMALL(coeff(i) - expected(i), 1e-4f);
+  }
+
+  // reference: integrate the squared acceleration numerically (Simpson's rule)
+  const auto acceleration = [&coeff](const float t) {
+    return 2 * coeff(2) + 6 * coeff(3) * t + 12 * coeff(4) * t * t + 20 * coeff(5) * t * t * t;
+  };
+  const int n{1000};
+  const float h{T / n};
+  float integral{0.0f};
+  for (int i = 0; i < n; ++i) {
+    const float a0{acceleration(i * h)};
+    const float a1{acceleration((i + 0.5f) * h)};
+    const float a2{acceleration((i + 1) * h)};
+    integral += h / 6 * (a0 * a0 + 4 * a1 * a1 + a2 * a2);
+  }
+  BOOST_CHECK_CLOSE(basis.squaredAccelerationIntegral(coeff), integral, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(batchTrajectories) {
+  const Vehicle vehicle(config::vehicle);
+  ActionSet actions;
+  for (const float velocityChange : {-5.0f, 0.0f, 2.5f, 10.0f}) {
+    for (const float lateralChange : {-3.5f, 0.0f, 1.0f}) {
+      actions.push_back(std::make_shared<Action>(velocityChange, lateralChange));
+    }
+  }
+
+  for (const std::string name : {"jerkOptimal", "constantAcceleration"}) {
+    const auto generator    = TrajectoryGenerator::createTrajectoryGenerator(name);
+    const auto trajectories = generator->createTrajectories(0.0f, actions, vehicle);
+    BOOST_REQUIRE_EQUAL(trajectories.size(), actions.size());
+
+    for (std::size_t a = 0; a < actions.size(); ++a) {
+      const auto expected    = generator->createTrajectory(0.0f, actions[a], vehicle);
+      const auto& trajectory = trajectories[a];
+      BOOST_REQUIRE_EQUAL(trajectory.m_nSteps, expected.m_nSteps);
+      for (std::size_t i = 0; i < expected.m_nSteps; ++i) {
+        BOOST_CHECK_SMALL(trajectory.m_sPosition[i] - expected.m_sPosition[i], 1e-3f);
+        BOOST_CHECK_SMALL(trajectory.m_dPosition[i] - expected.m_dPosition[i], 1e-3f);
+        BOOST_CHECK_SMALL(trajectory.m_sVelocity[i] - expected.m_sVelocity[i], 1e-3f);
+        BOOST_CHECK_SMALL(trajectory.m_dVelocity[i] - expected.m_dVelocity[i], 1e-3f);
+        BOOST_CHECK_SMALL(trajectory.m_heading[i] - expected.m_heading[i], 1e-3f);
+      }
+      BOOST_CHECK_SMALL(
+          trajectory.m_cumSquaredAccelerationLon - expected.m_cumSquaredAccelerationLon, 1e-3f);
+      BOOST_CHECK_SMALL(
+          trajectory.m_cumSquaredAccelerationLat - expected.m_cumSquaredAccelerationLat, 1e-3f);
+      BOOST_CHECK_EQUAL(trajectory.m_laneChange, expected.m_laneChange);
+      BOOST_CHECK_EQUAL(trajectory.m_invalidAction, expected.m_invalidAction);
+      BOOST_CHECK_EQUAL(trajectory.m_invalidState, expected.m_invalidState);
+    }
+
+    // the reused trajectories are reset, regardless of the actions they have been created for
+    auto reused = trajectories;
+    generator->createTrajectories(0.0f, {actions.rbegin(), actions.rend()}, vehicle, reused);
+    BOOST_REQUIRE_EQUAL(reused.size(), actions.size());
+    for (std::size_t a = 0; a < actions.size(); ++a) {
+      const auto& expected = trajectories[actions.size() - 1 - a];
+      BOOST_CHECK(std::ranges::equal(reused[a].m_sPosition, expected.m_sPosition));
+      BOOST_CHECK(reused[a].m_finalState == expected.m_finalState);
+      BOOST_CHECK_EQUAL(reused[a].m_cumSquaredAccelerationLat,
+                        expected.m_cumSquaredAccelerationLat);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(trajectoryStorage) {
+  const Vehicle vehicle(config::vehicle);
+  const auto action    = std::make_shared<Action>(2.5f, 1.0f);
+  const auto generator = TrajectoryGenerator::createTrajectoryGenerator("jerkOptimal");
+  const auto original  = generator->createTrajectory(0.0f, action, vehicle);
+  BOOST_REQUIRE_LE(original.m_nSteps, Trajectory::inlineSteps);
+
+  // the copy has its own storage
+  auto copy = original;
+  BOOST_CHECK(std::ranges::equal(copy.m_dPosition, original.m_dPosition));
+  BOOST_CHECK(std::ranges::equal(copy.m_lane, original.m_lane));
+  BOOST_CHECK(copy.m_finalState == original.m_finalState);
+  copy.m_dPosition[0] += 1.0f;
+  BOOST_CHECK_NE(copy.m_dPosition[0], original.m_dPosition[0]);
+
+  // trajectories exceeding the inline storage are moved without copying their values
+  json jOptions(config::optionsSimple.toJSON());
+  jOptions["compute_options"]["delta_t"] = 0.05f;
+  Config::get()->reset();
+  Config::create(config::scenarioSimple, config::Options::fromJSON(jOptions));
+  auto longTrajectory = generator->createTrajectory(0.0f, action, vehicle);
+  BOOST_REQUIRE_GT(longTrajectory.m_nSteps, Trajectory::inlineSteps);
+  const auto longCopy{longTrajectory};
+  const auto* values{longTrajectory.m_sPosition.data()};
+  const auto moved{std::move(longTrajectory)};
+  BOOST_CHECK_EQUAL(moved.m_sPosition.data(), values);
+  BOOST_CHECK_EQUAL(longTrajectory.m_nSteps, 0u);
+  BOOST_CHECK(std::ranges::equal(moved.m_sPosition, longCopy.m_sPosition));
+  BOOST_CHECK(std::ranges::equal(moved.m_heading, longCopy.m_heading));
+  BOOST_CHECK_EQUAL(moved.m_sPosition.back(), longCopy.m_sPosition.back());
+
+  // a trajectory switches between the heap and the inline storage on assignment
+  copy = longCopy;
+  BOOST_CHECK(std::ranges::equal(copy.m_totalVelocity, longCopy.m_totalVelocity));
+  copy = original;
+  BOOST_CHECK_EQUAL(copy.m_nSteps, original.m_nSteps);
+  BOOST_CHECK(std::ranges::equal(copy.m_sPosition, original.m_sPosition));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,62 @@
+/**
+ * @file test_threadPool.cpp
+ * @brief This file defines the test cases for the thread pool.
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include <atomic>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "proseco_planning/util/threadPool.h"
+
+using namespace proseco_planning;
+
+BOOST_AUTO_TEST_SUITE(threadPool)
+
+BOOST_AUTO_TEST_CASE(submit) {
+  util::ThreadPool pool(4, false);
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.push_back(pool.submit([i] { return i * i; }));
+  }
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK_EQUAL(futures[i].get(), i * i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(nested_parallel_for) {
+  // nested calls from within the tasks of the pool must not deadlock, even with a single worker
+  util::ThreadPool pool(1, false);
+  std::atomic<int> count{0};
+  auto future = pool.submit([&pool, &count] {
+    pool.parallelFor(8, [&pool, &count](const std::size_t) {
+      pool.parallelFor(8, [&count](const std::size_t) { ++count; });
+    });
+  });
+  future.get();
+  BOOST_CHECK_EQUAL(count, 64);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_exception) {
+  util::ThreadPool pool(2, false);
+  std::vector<int> visited(16, 0);
+  BOOST_CHECK_THROW(pool.parallelFor(16,
+                                     [&visited](const std::size_t i) {
+                                       visited[i] = 1;
+                                       if (i == 3) throw std::runtime_error("failure");
+                                     }),
+                    std::runtime_error);
+  // the remaining invocations are still run
+  for (const auto v : visited) {
+    BOOST_CHECK_EQUAL(v, 1);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
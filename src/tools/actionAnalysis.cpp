@@ -10,6 +10,7 @@
  */
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -59,36 +60,44 @@ int main(int argc, char* argv[]) {
   jActionClasses["cost_model"] = sOpt().agents[0].cost_model.name;
   jActionClasses["actions"]    = json::array();
 
+  ActionSet actions;
   for (const auto& d_lat_y : changeLateral) {
     for (const auto& d_lon_v : changeVelocity) {
       auto action = std::make_shared<Action>(d_lon_v, d_lat_y);
       action->updateActionClass(*actionSpace, agent.m_vehicle);
-      agent.setAction(action, *trajectoryGenerator);
-      const auto [minAcceleration, maxAcceleration] =
-          std::minmax_element(begin(agent.m_trajectory.m_totalAcceleration),
-                              end(agent.m_trajectory.m_totalAcceleration));
-      const auto [minVelocity, maxVelocity] = std::minmax_element(
-          begin(agent.m_trajectory.m_totalVelocity), end(agent.m_trajectory.m_totalVelocity));
-      const auto [minSteeringAngle, maxSteeringAngle] = std::minmax_element(
-          begin(agent.m_trajectory.m_steeringAngle), end(agent.m_trajectory.m_steeringAngle));
-      json jAction{{"d_lon_v", d_lon_v},
-                   {"d_lat_y", d_lat_y},
-                   {"class", ActionSpace::ACTION_CLASS_NAME_MAP.at(action->m_actionClass)},
-                   {"cost_acc_x", costModel->costAccelerationX(agent.m_trajectory)},
-                   {"cost_acc_y", costModel->costAccelerationY(agent.m_trajectory)},
-                   {"cost_change_lane", costModel->costLaneChange(agent.m_trajectory)},
-                   {"cost_total", agent.m_actionCost},
-                   {"minTotalAcceleration", *minAcceleration},
-                   {"maxTotalAcceleration", *maxAcceleration},
-                   {"minTotalVelocity", *minVelocity},
-                   {"maxTotalVelocity", *maxVelocity},
-                   {"maxAbsSteeringAngle",
-                    std::max(std::abs(*minSteeringAngle), std::abs(*maxSteeringAngle))},
-                   {"invalid", agent.m_trajectory.m_invalidAction}};
-
-      jActionClasses["actions"].push_back(jAction);
+      actions.push_back(action);
     }
   }
+  // all actions start from the same state of the agent
+  const auto trajectories = trajectoryGenerator->createTrajectories(0.0f, actions, agent.m_vehicle);
+
+  for (std::size_t i = 0; i < actions.size(); ++i) {
+    const auto& action = actions[i];
+    agent.setAction(trajectories[i], agent.m_costModel->calculateActionCost(trajectories[i]));
+    const auto [minAcceleration, maxAcceleration] =
+        std::minmax_element(begin(agent.m_trajectory.m_totalAcceleration),
+                            end(agent.m_trajectory.m_totalAcceleration));
+    const auto [minVelocity, maxVelocity] = std::minmax_element(
+        begin(agent.m_trajectory.m_totalVelocity), end(agent.m_trajectory.m_totalVelocity));
+    const auto [minSteeringAngle, maxSteeringAngle] = std::minmax_element(
+        begin(agent.m_trajectory.m_steeringAngle), end(agent.m_trajectory.m_steeringAngle));
+    json jAction{{"d_lon_v", action->m_velocityChange},
+                 {"d_lat_y", action->m_lateralChange},
+                 {"class", ActionSpace::ACTION_CLASS_NAME_MAP.at(action->m_actionClass)},
+                 {"cost_acc_x", costModel->costAccelerationX(agent.m_trajectory)},
+                 {"cost_acc_y", costModel->costAccelerationY(agent.m_trajectory)},
+                 {"cost_change_lane", costModel->costLaneChange(agent.m_trajectory)},
+                 {"cost_total", agent.m_actionCost},
+                 {"minTotalAcceleration", *minAcceleration},
+                 {"maxTotalAcceleration", *maxAcceleration},
+                 {"minTotalVelocity", *minVelocity},
+                 {"maxTotalVelocity", *maxVelocity},
+                 {"maxAbsSteeringAngle",
+                  std::max(std::abs(*minSteeringAngle), std::abs(*maxSteeringAngle))},
+                 {"invalid", agent.m_trajectory.m_invalidAction}};
+
+    jActionClasses["actions"].push_back(jAction);
+  }
 
   // Sort the output by action class
   // std::sort(jActionClasses["actions"].begin(), jActionClasses["actions"].end(),
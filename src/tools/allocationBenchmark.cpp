@@ -0,0 +1,97 @@
+/**
+ * @file allocationBenchmark.cpp
+ * @brief This tool measures the number of heap allocations per MCTS iteration, including the
+ * release of the search tree at the end of each planning step.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#include "allocationCounter.h"
+#include "proseco_planning/config/computeOptions.h"
+#include "proseco_planning/config/configuration.h"
+#include "proseco_planning/config/scenarioOptions.h"
+#include "proseco_planning/monteCarloTreeSearch.h"
+#include "proseco_planning/node.h"
+#include "proseco_planning/searchContext.h"
+#include "proseco_planning/trajectory/trajectoryMemo.h"
+#include "proseco_planning/util/utilities.h"
+
+using namespace proseco_planning;
+
+/**
+ * @brief Usage: proseco_planning_tool_allocation_benchmark <options.json> <scenario.json> [steps]
+ *
+ * @details Runs `steps` planning steps from the initial scenario and prints the allocation
+ * statistics as JSON.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <options.json> <scenario.json> [steps]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  util::createConfig(std::string(argv[1]), std::string(argv[2]));
+  const int steps{argc > 3 ? std::stoi(argv[3]) : 10};
+
+  std::size_t allocations{0};
+  std::size_t deallocations{0};
+  std::size_t bytes{0};
+  double duration{0.0};
+  double releaseDuration{0.0};
+  unsigned int nIterations{0};
+
+  SearchContext context(cOpt().parallelization_options);
+  for (int step = 0; step < steps; ++step) {
+    auto root = std::make_unique<Node>(sOpt().agents);
+
+    const auto start     = tools::allocationCount();
+    const auto startTime = std::chrono::steady_clock::now();
+
+    computeActionSetSequence(std::move(root), step, context);
+    const auto planningTime = std::chrono::steady_clock::now();
+
+    // the search tree is released in the background after `computeActionSetSequence` returns
+    context.waitForRelease();
+
+    const auto end = tools::allocationCount();
+    duration += std::chrono::duration<double>(planningTime - startTime).count();
+    releaseDuration +=
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - planningTime).count();
+    allocations += end.allocations - start.allocations;
+    deallocations += end.deallocations - start.deallocations;
+    bytes += end.bytes - start.bytes;
+    nIterations += context.lastIterationCount();
+  }
+
+  // the iterations actually run, which may be fewer than configured due to early stopping
+  const double iterations{static_cast<double>(nIterations)};
+  json jResult;
+  jResult["agents"]                    = sOpt().agents.size();
+  jResult["steps"]                     = steps;
+  jResult["iterations_per_step"]       = iterations / steps;
+  jResult["allocations"]               = allocations;
+  jResult["deallocations"]             = deallocations;
+  jResult["allocations_per_iteration"] = allocations / iterations;
+  jResult["bytes_per_iteration"]       = bytes / iterations;
+  jResult["time_per_iteration_us"]     = duration * 1e6 / iterations;
+  jResult["release_wait_per_step_us"]  = releaseDuration * 1e6 / steps;
+
+  // the hit rates of the memos shared between sibling nodes, including a retained search tree
+  context.resetTreeReuse();
+  const auto memo = context.memoStatistics();
+  jResult["trajectory_memo_hit_rate"] =
+      static_cast<double>(memo.trajectoryHits) / (memo.trajectoryHits + memo.trajectoryMisses);
+  jResult["collision_memo_hit_rate"] =
+      static_cast<double>(memo.collisionHits) / (memo.collisionHits + memo.collisionMisses);
+  std::cout << jResult.dump(2) << std::endl;
+}
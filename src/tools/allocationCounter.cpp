@@ -0,0 +1,38 @@
+#include "allocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<std::size_t> g_allocations{0};
+std::atomic<std::size_t> g_deallocations{0};
+std::atomic<std::size_t> g_bytes{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+  ++g_allocations;
+  g_bytes += size;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr == nullptr) return;
+  ++g_deallocations;
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept { operator delete(ptr); }
+
+namespace proseco_planning::tools {
+
+/**
+ * @brief Returns the number of heap allocations since the start of the process.
+ *
+ * @return AllocationCount The allocation count.
+ */
+AllocationCount allocationCount() {
+  return {g_allocations.load(), g_deallocations.load(), g_bytes.load()};
+}
+}  // namespace proseco_planning::tools
@@ -0,0 +1,32 @@
+/**
+ * @file allocationCounter.h
+ * @brief This file declares the heap allocation counter of the benchmark tools. Linking
+ * allocationCounter.cpp into a tool replaces the global `operator new` and `operator delete` with
+ * counting versions.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace proseco_planning::tools {
+
+/**
+ * @brief The AllocationCount struct holds the number of heap allocations of the process.
+ *
+ */
+struct AllocationCount {
+  /// The number of allocations.
+  std::size_t allocations;
+  /// The number of deallocations.
+  std::size_t deallocations;
+  /// The number of allocated bytes.
+  std::size_t bytes;
+};
+
+AllocationCount allocationCount();
+
+}  // namespace proseco_planning::tools
@@ -0,0 +1,114 @@
+/**
+ * @file parallelBenchmark.cpp
+ * @brief This tool compares the root parallelization and the tree parallelization in terms of
+ * iterations per second and plan quality for different numbers of threads.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#include "proseco_planning/collision_checker/collisionChecker.h"
+#include "proseco_planning/config/computeOptions.h"
+#include "proseco_planning/config/configuration.h"
+#include "proseco_planning/config/scenarioOptions.h"
+#include "proseco_planning/math/mathlib.h"
+#include "proseco_planning/monteCarloTreeSearch.h"
+#include "proseco_planning/node.h"
+#include "proseco_planning/searchContext.h"
+#include "proseco_planning/trajectory/trajectorygenerator.h"
+#include "proseco_planning/util/alias.h"
+#include "proseco_planning/util/utilities.h"
+
+using namespace proseco_planning;
+
+/**
+ * @brief Executes the plan from the initial state of the scenario and returns the cooperative
+ * reward of all agents summed over the plan.
+ *
+ * @param plan The action set sequence.
+ * @return float The reward of the plan.
+ */
+float evaluatePlan(const std::vector<ActionSet>& plan) {
+  auto collisionChecker    = CollisionChecker::createCollisionChecker(cOpt().collision_checker);
+  auto trajectoryGenerator = TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+  auto node                = std::make_unique<Node>(sOpt().agents);
+  float reward{0.0f};
+  for (const auto& actionSet : plan) {
+    node->executeActions(actionSet, *collisionChecker, *trajectoryGenerator, false);
+    for (const auto& agent : node->m_agents) {
+      reward += agent.m_coopReward;
+    }
+    if (node->m_invalid) break;
+  }
+  return reward;
+}
+
+/**
+ * @brief Usage: proseco_planning_tool_parallel_benchmark <options.json> <scenario.json> [steps]
+ *
+ * @details Runs `steps` planning steps from the initial scenario for the root and the tree
+ * parallelization with 1 to 32 threads. The results are printed as JSON.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <options.json> <scenario.json> [steps]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto jOptions  = util::loadJSON(std::string(argv[1]));
+  const auto jScenario = util::loadJSON(std::string(argv[2]));
+  const int steps{argc > 3 ? std::stoi(argv[3]) : 5};
+
+  json jResults = json::array();
+  for (const std::string mode : {"root", "tree"}) {
+    for (const unsigned int nThreads : {1u, 2u, 4u, 8u, 16u, 32u}) {
+      auto jModifiedOptions = jOptions;
+      auto& jParallelizationOptions =
+          jModifiedOptions["compute_options"]["parallelization_options"];
+      jParallelizationOptions["n_threads"] = nThreads;
+      jParallelizationOptions["mode"]      = mode;
+
+      Config::reset();
+      const auto options = config::Options::fromJSON(jModifiedOptions);
+      math::Random::setRandomSeed(options.compute_options.random_seed);
+      Config::create(config::Scenario::fromJSON(jScenario), options);
+
+      SearchContext context(cOpt().parallelization_options);
+      double duration{0.0};
+      unsigned int nIterations{0};
+      std::vector<float> rewards;
+      for (int step = 0; step < steps; ++step) {
+        auto root            = std::make_unique<Node>(sOpt().agents);
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto plan      = computeActionSetSequence(std::move(root), step, context);
+        duration +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        nIterations += context.lastIterationCount();
+        rewards.push_back(evaluatePlan(plan));
+      }
+
+      // with root parallelization the iterations of all trees are counted
+      const double iterations{static_cast<double>(nIterations)};
+      json jResult;
+      jResult["mode"]                  = mode;
+      jResult["threads"]               = nThreads;
+      jResult["steps"]                 = steps;
+      jResult["iterations_per_second"] = iterations / duration;
+      jResult["time_per_step_ms"]      = duration * 1e3 / steps;
+      jResult["plan_reward_mean"]      = math::meanFromVector(rewards);
+      jResult["plan_reward_std"]       = math::stdFromVector(rewards);
+      jResults.push_back(jResult);
+    }
+  }
+  std::cout << jResults.dump(2) << std::endl;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file selectionBenchmark.cpp
+ * @brief This tool measures the cost of the child lookups during the selection descent through the
+ * search tree for different numbers of agents and search depths.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#include "proseco_planning/agent/agent.h"
+#include "proseco_planning/config/configuration.h"
+#include "proseco_planning/config/scenarioOptions.h"
+#include "proseco_planning/math/mathlib.h"
+#include "proseco_planning/node.h"
+#include "proseco_planning/util/alias.h"
+#include "proseco_planning/util/utilities.h"
+
+using namespace proseco_planning;
+
+/**
+ * @brief Builds a search tree by random descents, where every visited node is widened to `width`
+ * children with random joint actions, and records the action ids along each descent.
+ *
+ * @param root The root node.
+ * @param nPaths The number of descents.
+ * @param depth The depth of each descent.
+ * @param width The number of children of each visited node.
+ * @return std::vector<std::vector<ActionIdSet>> The action ids along each descent.
+ */
+std::vector<std::vector<ActionIdSet>> buildTree(Node* const root, const std::size_t nPaths,
+                                                const unsigned int depth, const std::size_t width) {
+  for (auto& agent : root->m_agents) {
+    agent.setAvailableActions(root->m_depth);
+  }
+
+  std::vector<std::vector<ActionIdSet>> paths(nPaths);
+  for (auto& path : paths) {
+    auto node = root;
+    for (unsigned int d = 0; d < depth; ++d) {
+      while (node->m_childMap.size() < width) {
+        ActionSet actionSet;
+        for (const auto& agent : node->m_agents) {
+          actionSet.push_back(math::getRandomElementFromVector(agent.m_availableActions));
+        }
+        node->addChild(actionSet);
+      }
+      // continue the descent with a random child
+      const auto index =
+          static_cast<std::size_t>(math::getRandomNumberInInterval<float>(0.0f, 1.0f) * width);
+      auto child = node->m_childMap.child(std::min(index, width - 1));
+      // the lookup key is a copy, as it is the case for the selection policy
+      path.push_back(ActionIdSet(child->m_actionIds));
+      node = child;
+    }
+  }
+  return paths;
+}
+
+/**
+ * @brief Usage: proseco_planning_tool_selection_benchmark <options.json> <scenario.json> [width]
+ *
+ * @details Replicates the first agent of the scenario to 4, 8 and 16 agents and measures the
+ * selection descent for the depths 6, 7 and 8. The results are printed as JSON.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <options.json> <scenario.json> [width]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  util::createConfig(std::string(argv[1]), std::string(argv[2]));
+  const std::size_t width{argc > 3 ? std::stoul(argv[3]) : 16};
+  const std::size_t nPaths{32};
+  const std::size_t nRepetitions{2000};
+
+  json jResults = json::array();
+  for (const unsigned int nAgents : {4u, 8u, 16u}) {
+    std::vector<Agent> agents;
+    for (unsigned int id = 0; id < nAgents; ++id) {
+      agents.emplace_back(sOpt().agents[0]);
+      agents.back().m_id = id;
+    }
+
+    for (const unsigned int depth : {6u, 7u, 8u}) {
+      auto root  = std::make_unique<Node>(agents);
+      auto paths = buildTree(root.get(), nPaths, depth, width);
+
+      std::size_t checksum{0};
+      const auto startTime = std::chrono::steady_clock::now();
+      for (std::size_t r = 0; r < nRepetitions; ++r) {
+        for (const auto& path : paths) {
+          const Node* node = root.get();
+          for (const auto& actionIds : path) {
+            node = node->getChild(actionIds);
+          }
+          checksum += node->m_depth;
+        }
+      }
+      const double duration{
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count()};
+
+      json jResult;
+      jResult["agents"]         = nAgents;
+      jResult["depth"]          = depth;
+      jResult["width"]          = width;
+      jResult["ns_per_descent"] = duration * 1e9 / (nRepetitions * nPaths);
+      jResult["ns_per_lookup"]  = duration * 1e9 / (nRepetitions * nPaths * depth);
+      jResult["checksum"]       = checksum;
+      jResults.push_back(jResult);
+    }
+  }
+  std::cout << jResults.dump(2) << std::endl;
+}
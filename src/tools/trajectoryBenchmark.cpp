@@ -0,0 +1,98 @@
+/**
+ * @file trajectoryBenchmark.cpp
+ * @brief This tool measures the throughput of the trajectory generation for the available actions
+ * of the agents of a scenario.
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#include "proseco_planning/agent/agent.h"
+#include "proseco_planning/config/computeOptions.h"
+#include "proseco_planning/config/configuration.h"
+#include "proseco_planning/config/scenarioOptions.h"
+#include "proseco_planning/trajectory/trajectory.h"
+#include "proseco_planning/trajectory/trajectorygenerator.h"
+#include "proseco_planning/util/utilities.h"
+
+using namespace proseco_planning;
+
+/**
+ * @brief Usage: proseco_planning_tool_trajectory_benchmark <options.json> <scenario.json>
+ * [repetitions]
+ *
+ * @details Creates the trajectory of every available action of every agent of the scenario
+ * `repetitions` times with the configured trajectory generator, one action at a time and batched
+ * per agent, and prints the throughput as JSON.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <options.json> <scenario.json> [repetitions]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  util::createConfig(std::string(argv[1]), std::string(argv[2]));
+  const std::size_t nRepetitions{argc > 3 ? std::stoul(argv[3]) : 1000};
+
+  auto trajectoryGenerator = TrajectoryGenerator::createTrajectoryGenerator(cOpt().trajectory_type);
+  std::vector<Agent> agents;
+  for (const auto& agentOptions : sOpt().agents) {
+    agents.emplace_back(agentOptions);
+    agents.back().setAvailableActions(0);
+  }
+
+  std::size_t nTrajectories{0};
+  double checksum{0.0};
+  auto startTime = std::chrono::steady_clock::now();
+  for (std::size_t r = 0; r < nRepetitions; ++r) {
+    for (const auto& agent : agents) {
+      for (const auto& action : agent.m_availableActions) {
+        const auto trajectory =
+            trajectoryGenerator->createTrajectory(0.0f, action, agent.m_vehicle);
+        checksum += trajectory.m_cumSquaredAccelerationLon + trajectory.m_cumSquaredAccelerationLat;
+        ++nTrajectories;
+      }
+    }
+  }
+  const double duration{
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count()};
+
+  // the trajectories of all available actions of an agent at once, reusing the trajectories of the
+  // previous repetition
+  std::vector<std::vector<Trajectory>> trajectories(agents.size());
+  double checksumBatched{0.0};
+  startTime = std::chrono::steady_clock::now();
+  for (std::size_t r = 0; r < nRepetitions; ++r) {
+    for (std::size_t i = 0; i < agents.size(); ++i) {
+      trajectoryGenerator->createTrajectories(0.0f, agents[i].m_availableActions,
+                                              agents[i].m_vehicle, trajectories[i]);
+      for (const auto& trajectory : trajectories[i]) {
+        checksumBatched +=
+            trajectory.m_cumSquaredAccelerationLon + trajectory.m_cumSquaredAccelerationLat;
+      }
+    }
+  }
+  const double durationBatched{
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count()};
+
+  json jResult;
+  jResult["trajectory_type"]                 = cOpt().trajectory_type;
+  jResult["trajectories"]                    = nTrajectories;
+  jResult["ns_per_trajectory"]               = duration * 1e9 / nTrajectories;
+  jResult["ns_per_trajectory_batched"]       = durationBatched * 1e9 / nTrajectories;
+  jResult["trajectories_per_second"]         = nTrajectories / duration;
+  jResult["trajectories_per_second_batched"] = nTrajectories / durationBatched;
+  jResult["checksum"]                        = checksum / nRepetitions;
+  jResult["checksum_batched"]                = checksumBatched / nRepetitions;
+  std::cout << jResult.dump(2) << std::endl;
+}